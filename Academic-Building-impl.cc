@@ -9,40 +9,49 @@
 
 module AcademicBuilding;
 
+import <array>;
+import <cstdint>;
 import <iostream>;
-import <map>;
-import <vector>;
+import <stdexcept>;
 import LandAction;
+import BoardState;
 
-// Constructor initializes building fields and improvement tracking.
-AcademicBuilding::AcademicBuilding(std::string name, int position, int price,
-                                   std::string monopolyBlock, int improvementCost)
-    : Building{name, position, price}, 
-      monopolyBlock{monopolyBlock}, 
-      improvementCost{improvementCost}, 
-      improvements{0} {}
+// Constructor records the definition entry; improvements start at 0 in
+// the board's state.
+AcademicBuilding::AcademicBuilding(const BoardDefinition& layout, int position)
+    : Building{layout, position} {}
 
 // Returns the name of the monopoly block (e.g., "Math", "Env").
-std::string AcademicBuilding::getMonopolyBlock() const {
-    return monopolyBlock;
+const std::string& AcademicBuilding::getMonopolyBlock() const {
+    return definition().block;
 }
 
+int AcademicBuilding::getBlockId() const {
+    return layout->blocks.blockOf(position);
+}
+
+// Improvement changes also move the owner's improvement total and the
+// block's improvement count.
 void AcademicBuilding::addImprovement() {
-    if (improvements >= 5) throw std::runtime_error("Max improvements reached");
-    ++improvements;
+    if (getImprovementCount() >= 5) throw std::runtime_error("Max improvements reached");
+    forceSetImprovements(getImprovementCount() + 1);
 }
 
 void AcademicBuilding::removeImprovement() {
-    if (improvements <= 0) throw std::runtime_error("No improvements to remove");
-    --improvements;
+    if (getImprovementCount() <= 0) throw std::runtime_error("No improvements to remove");
+    forceSetImprovements(getImprovementCount() - 1);
+}
+
+int AcademicBuilding::getImprovementValue() const {
+    return getImprovementCount() * getImprovementCost();
 }
 
 int AcademicBuilding::getImprovementCount() const {
-    return improvements;
+    return state ? state->improvements[position] : 0;
 }
 
 int AcademicBuilding::getImprovementCost() const {
-    return improvementCost;
+    return definition().improvementCost;
 }
 
 
@@ -52,10 +61,11 @@ int AcademicBuilding::getImprovementCost() const {
 LandAction AcademicBuilding::onLand(Player* p) {
     std::cout << p->getName() << " landed on Academic Building " << getName() << ".\n";
 
-    if (getOwnerToken() == "BANK") {
+    Player* owner = getOwner();
+    if (!owner) {
         std::cout << "You may buy this for $" << getPrice() << ".\n";
         return LandAction::PromptPurchase;
-    } else if (getOwnerToken() != p->getToken()) {
+    } else if (owner != p) {
         std::cout << "Rent logic for academic buildings goes here (considering improvements).\n";
         return LandAction::PayRent;
     } else {
@@ -65,44 +75,27 @@ LandAction AcademicBuilding::onLand(Player* p) {
 }
 
 int AcademicBuilding::calculateRent(int context) const {
-    // Rent depends only on improvements
-    static const std::map<std::string, std::vector<int>> rentTable = {
-        { "AL", {2, 10, 30, 90, 160, 250} },
-        { "ML", {4, 20, 60, 180, 320, 450} },
-        { "ECH", {6, 30, 90, 270, 400, 550} },
-        { "PAS", {6, 30, 90, 270, 400, 550} },
-        { "HH", {8, 40, 100, 300, 450, 600} },
-        { "RCH", {10, 50, 150, 450, 625, 750} },
-        { "DWE", {10, 50, 150, 450, 625, 750} },
-        { "CPH", {12, 60, 180, 500, 700, 900} },
-        { "LHI", {14, 70, 200, 550, 750, 950} },
-        { "BMH", {14, 70, 200, 550, 750, 950} },
-        { "OPT", {16, 80, 220, 600, 800, 1000} },
-        { "EV1", {18, 90, 250, 700, 875, 1050} },
-        { "EV2", {18, 90, 250, 700, 875, 1050} },
-        { "EV3", {20, 100, 300, 750, 925, 1100} },
-        { "PHYS", {22, 110, 330, 800, 975, 1150} },
-        { "B1", {22, 110, 330, 800, 975, 1150} },
-        { "B2", {24, 120, 360, 850, 1025, 1200} },
-        { "EIT", {26, 130, 390, 900, 1100, 1275} },
-        { "ESC", {26, 130, 390, 900, 1100, 1275} },
-        { "C2", {28, 150, 450, 1000, 1200, 1400} },
-        { "MC", {35, 175, 500, 1100, 1300, 1500} },
-        { "DC", {50, 200, 600, 1400, 1700, 2000} }
-    };
-
-    auto it = rentTable.find(getName());
-    if (it == rentTable.end()) return 0;
-
-    if (context == 1 && improvements == 0) {
-        return it->second[0] * 2;
+    return rentAtLevel(getImprovementCount(), context == 1);
+}
+
+int AcademicBuilding::rentAtLevel(int level, bool monopoly) const {
+    // Rent depends only on improvements (ladder from the board definition)
+    const std::array<int, 6>& rent = definition().rent;
+    if (monopoly && level == 0) {
+        return rent[0] * 2;
     }
 
-    return it->second[improvements];  // 0–5
+    return rent[level];  // 0–5
 }
 
 void AcademicBuilding::forceSetImprovements(int n) {
-    improvements = n;
+    if (!state) throw std::logic_error("Building " + getName() + " is not on a board");
+    if (n < 0 || n > 5) throw std::out_of_range("Improvement count out of range for " + getName());
+
+    const int delta = n - getImprovementCount();
+    if (Player* owner = getOwner()) owner->adjustAssets(0, delta * getImprovementCost(), 0);
+    state->blocks.adjustImprovements(getBlockId(), delta);
+    state->improvements[position] = static_cast<std::uint8_t>(n);
 }
 
 
@@ -5,7 +5,9 @@
 //   Each academic building belongs to a monopoly block (e.g., "Arts1", "Eng").
 //   Buildings can be improved up to 5 times (4 bathrooms + 1 cafeteria).
 //
-//   Improvement count affects rent calculation (to be implemented).
+//   Improvement count selects the rent from the building's rent ladder.
+//   The ladder, block and improvement cost are read from the shared board
+//   definition; the improvement count is kept in the board's BoardState.
 //   GameController is responsible for invoking improvement-related actions
 //   and checking monopoly ownership.
 //
@@ -17,21 +19,21 @@ export module AcademicBuilding;
 import LandAction;
 import Building;  // Inherits from Building, which is-a Square
 import Player;
+import BoardDefinition;
 import <string>;
 
+// Block, improvement cost and rent ladder come from the board definition;
+// the improvement level lives in the board's BoardState.
 export class AcademicBuilding : public Building {
-private:
-    std::string monopolyBlock;   // Name of the monopoly block this building belongs to
-    int improvementCost;         // Cost per improvement (bathroom/cafeteria)
-    int improvements;            // Current number of improvements (0–5)
-
 public:
-    // Constructs an academic building with monopoly metadata and improvement cost.
-    AcademicBuilding(std::string name, int position, int price,
-                     std::string monopolyBlock, int improvementCost);
+    // Constructs the academic building at a position of a board definition.
+    AcademicBuilding(const BoardDefinition& layout, int position);
 
     // Returns the monopoly block name (e.g., "Sci1", "Math").
-    std::string getMonopolyBlock() const;
+    const std::string& getMonopolyBlock() const;
+
+    // Block ID in the board's BlockIndex.
+    int getBlockId() const;
 
     // Called when a player lands on this academic building.
     // Displays rent/purchase logic. Future version will calculate rent based on improvements.
@@ -39,16 +41,22 @@ public:
 
     int calculateRent(int context = 0) const override;
 
+    // Rent this building would charge at the given improvement level
+    // (monopoly doubles the unimproved rent). Used to value hypotheticals.
+    int rentAtLevel(int level, bool monopoly) const;
+
     void addImprovement();             // increments improvement count
 
     void removeImprovement();          // decrements
 
     int getImprovementCount() const;   // returns count
     
-    int getImprovementCost() const;    // stored from constructor
+    int getImprovementCost() const;    // from the board definition
 
     void forceSetImprovements(int n); // Bypasses monopoly/improvement checks (for load only)
 
+    int getImprovementValue() const override;  // improvements * improvement cost
+
 
 
 
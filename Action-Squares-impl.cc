@@ -14,8 +14,8 @@ import LandAction;  // New enum for signaling control flow
 import Player;
 
 // -------- ActionSquare --------
-ActionSquare::ActionSquare(std::string name, int position)
-    : Square{name, position} {}
+ActionSquare::ActionSquare(const BoardDefinition& layout, int position)
+    : Square{layout, position} {}
 
 LandAction ActionSquare::onLand(Player* p) {
     std::cout << p->getName() << " landed on " << getName()
@@ -24,8 +24,8 @@ LandAction ActionSquare::onLand(Player* p) {
 }
 
 // -------- COLLECTOSAP --------
-COLLECTOSAP::COLLECTOSAP(std::string name, int position)
-    : Square{name, position} {}
+COLLECTOSAP::COLLECTOSAP(const BoardDefinition& layout, int position)
+    : Square{layout, position} {}
 
 LandAction COLLECTOSAP::onLand(Player* p) {
     std::cout << p->getName() << " landed on " << getName()
@@ -35,8 +35,8 @@ LandAction COLLECTOSAP::onLand(Player* p) {
 }
 
 // -------- TUITION --------
-TUITION::TUITION(std::string name, int position)
-    : Square{name, position} {}
+TUITION::TUITION(const BoardDefinition& layout, int position)
+    : Square{layout, position} {}
 
 LandAction TUITION::onLand(Player* p) {
     std::cout << p->getName() << " landed on " << getName()
@@ -45,55 +45,42 @@ LandAction TUITION::onLand(Player* p) {
 }
 
 // -------- NEEDLESHALL --------
-NEEDLESHALL::NEEDLESHALL(std::string name, int position)
-    : Square{name, position} {}
+NEEDLESHALL::NEEDLESHALL(const BoardDefinition& layout, int position)
+    : Square{layout, position} {}
 
 LandAction NEEDLESHALL::onLand(Player* p) {
     return LandAction::NEEDLESHALL;
 }
 
 // -------- SLC --------
-SLC::SLC(std::string name, int position)
-    : Square{name, position} {}
+SLC::SLC(const BoardDefinition& layout, int position)
+    : Square{layout, position} {}
 
 LandAction SLC::onLand(Player* p) {
-    int roll = std::rand() % 24;  // 0 to 23
-    int move = 0;
+    return LandAction::SLC;
+}
+
+LandAction SLC::draw(Player* p, int roll) {
+    // One roll indexes the compiled table (standard board: 24 slots, 1/24
+    // Tims, 1/24 OSAP, the rest spread over moves of -3..+3).
+    const SlcOutcome& outcome = layout->slc.draw(roll);
     std::string explanation;
 
-    // --- Special Cases: 1/24 each ---
-    if (roll == 0) {
-        // 1/24 → Go to DC Tims Line
+    if (outcome.effect == SlcEffect::GoToTims) {
         explanation = "sent directly to DC Tims Line!";
         p->moveTo(10);
         p->setInTims(true);
         p->resetTimsTurns();
         std::cout << "[SLC] " << p->getName() << " is " << explanation << "\n";
         return LandAction::GoToTims;
-    } else if (roll == 1) {
-        // 1/24 → Advance to Collect OSAP
+    } else if (outcome.effect == SlcEffect::CollectOSAP) {
         explanation = "advanced to Collect OSAP!";
         p->moveTo(0);
         std::cout << "[SLC] " << p->getName() << " is " << explanation << "\n";
         return LandAction::COLLECTOSAP;
     }
 
-    // --- Movement Cases: Distribution math ---
-    // 22 outcomes left → assign as follows:
-    //  - Back 3     → 1/8    → 22 * (1/8)    = 2.75 ≈ 3 slots → roll 2–4
-    //  - Back 2     → 1/6    → 22 * (1/6)    = 3.66 ≈ 4 slots → roll 5–8
-    //  - Back 1     → 1/6    → 22 * (1/6)    = 3.66 ≈ 4 slots → roll 9–12
-    //  - Forward 1  → 1/8    → 22 * (1/8)    = 2.75 ≈ 3 slots → roll 13–15
-    //  - Forward 2  → 1/6    → 22 * (1/6)    = 3.66 ≈ 4 slots → roll 16–19
-    //  - Forward 3  → 1/6    → 22 * (1/6)    = 3.66 ≈ 4 slots → roll 20–23
-
-    if (roll <= 4) move = -3;        // roll 2–4 → 3 slots
-    else if (roll <= 8) move = -2;   // roll 5–8 → 4 slots
-    else if (roll <= 12) move = -1;  // roll 9–12 → 4 slots
-    else if (roll <= 15) move = 1;   // roll 13–15 → 3 slots
-    else if (roll <= 19) move = 2;   // roll 16–19 → 4 slots
-    else move = 3;                   // roll 20–23 → 4 slots
-
+    int move = outcome.move;
     int old = p->getPosition();
     p->move(move);
     int newPos = p->getPosition();
@@ -106,8 +93,8 @@ LandAction SLC::onLand(Player* p) {
 
 
 // -------- DCTimsLine --------
-DCTimsLine::DCTimsLine(std::string name, int position)
-    : Square{name, position} {}
+DCTimsLine::DCTimsLine(const BoardDefinition& layout, int position)
+    : Square{layout, position} {}
 
 LandAction DCTimsLine::onLand(Player* p) {
     std::cout << p->getName() << " landed on " << getName()
@@ -116,8 +103,8 @@ LandAction DCTimsLine::onLand(Player* p) {
 }
 
 // -------- GooseNesting --------
-GooseNesting::GooseNesting(std::string name, int position)
-    : Square{name, position} {}
+GooseNesting::GooseNesting(const BoardDefinition& layout, int position)
+    : Square{layout, position} {}
 
 LandAction GooseNesting::onLand(Player* p) {
     std::cout << "A flock of geese attack " << p->getName()
@@ -126,16 +113,16 @@ LandAction GooseNesting::onLand(Player* p) {
 }
 
 // -------- CoopFee --------
-CoopFee::CoopFee(std::string name, int position)
-    : Square{name, position} {}
+CoopFee::CoopFee(const BoardDefinition& layout, int position)
+    : Square{layout, position} {}
 
 LandAction CoopFee::onLand(Player* p) {
     return LandAction::PayCoopFee;
 }
 
 // -------- GoToTims --------
-GoToTims::GoToTims(std::string name, int position)
-    : Square{name, position} {}
+GoToTims::GoToTims(const BoardDefinition& layout, int position)
+    : Square{layout, position} {}
 
 LandAction GoToTims::onLand(Player* p) {
     std::cout << p->getName() << " landed on " << getName()
@@ -9,7 +9,7 @@
 //
 //   These classes are bundled together for simplicity because:
 //     - They are small and single-purpose
-//     - None require internal state beyond name and position
+//     - None require state beyond their board definition and position
 //     - Their onLand() logic is easily readable side-by-side
 //
 //   This follows CS246 principles of:
@@ -22,6 +22,7 @@ export module ActionSquares;
 import LandAction;
 import Square;
 import Player;
+import BoardDefinition;
 import <string>;
 
 // --------------------------------------------
@@ -30,7 +31,7 @@ import <string>;
 // --------------------------------------------
 export class ActionSquare : public Square {
 public:
-    ActionSquare(std::string name, int position);
+    ActionSquare(const BoardDefinition& layout, int position);
     LandAction onLand(Player* p) override;
 };
 
@@ -40,18 +41,24 @@ public:
 // --------------------------------------------
 export class NEEDLESHALL : public Square {
 public:
-    NEEDLESHALL(std::string name, int position);
+    NEEDLESHALL(const BoardDefinition& layout, int position);
     LandAction onLand(Player* p) override;
 };
 
 // --------------------------------------------
-// Moves the player to another square randomly.
-// Message-only for now.
+// Moves the player to another square randomly,
+// drawn from the board definition's SLC table.
+// onLand() only signals the landing; the controller
+// then calls draw() with a roll from its game's RNG.
 // --------------------------------------------
 export class SLC : public Square {
 public:
-    SLC(std::string name, int position);
+    SLC(const BoardDefinition& layout, int position);
     LandAction onLand(Player* p) override;
+
+    // Applies the card that `roll` selects and returns what the controller
+    // should do next (GoToTims, COLLECTOSAP or Teleport).
+    LandAction draw(Player* p, int roll);
 };
 
 // --------------------------------------------
@@ -60,7 +67,7 @@ public:
 // --------------------------------------------
 export class TUITION : public Square {
 public:
-    TUITION(std::string name, int position);
+    TUITION(const BoardDefinition& layout, int position);
     LandAction onLand(Player* p) override;
 };
 
@@ -70,7 +77,7 @@ public:
 // --------------------------------------------
 export class COLLECTOSAP : public Square {
 public:
-    COLLECTOSAP(std::string name, int position);
+    COLLECTOSAP(const BoardDefinition& layout, int position);
     LandAction onLand(Player* p) override;
 };
 
@@ -80,7 +87,7 @@ public:
 // --------------------------------------------
 export class DCTimsLine : public Square {
 public:
-    DCTimsLine(std::string name, int position);
+    DCTimsLine(const BoardDefinition& layout, int position);
     LandAction onLand(Player* p) override;
 };
 
@@ -89,7 +96,7 @@ public:
 // --------------------------------------------
 export class GooseNesting : public Square {
 public:
-    GooseNesting(std::string name, int position);
+    GooseNesting(const BoardDefinition& layout, int position);
     LandAction onLand(Player* p) override;
 };
 
@@ -98,12 +105,12 @@ public:
 // --------------------------------------------
 export class CoopFee : public Square {
 public:
-    CoopFee(std::string name, int position);
+    CoopFee(const BoardDefinition& layout, int position);
     LandAction onLand(Player* p) override;
 };
 
 export class GoToTims : public Square {
 public:
-    GoToTims(std::string name, int position);
+    GoToTims(const BoardDefinition& layout, int position);
     LandAction onLand(Player* p) override;
 };
\ No newline at end of file
@@ -0,0 +1,426 @@
+// Batch-Engine-impl.cc (implementation)
+// Module: BatchEngine
+// Description:
+//   A turn is a loop of rolls over the lanes still rolling. Each roll is a
+//   pass for the dice, the Tims line and the move, a pass for the lookup
+//   and payment of what the square costs, one crediting the owners, the
+//   compacted lanes one at a time, and the extra-turn mask. The passes
+//   read and write the mover's row with int masks (pick) rather than
+//   branches or bools, and `#pragma GCC ivdep` tells GCC the rows do not
+//   overlap, so at -O3 (see the Makefile) every pass but the compaction is
+//   vectorized; the rent pass only where the target has gathers (AVX2).
+
+module BatchEngine;
+
+import <algorithm>;
+import <cstddef>;
+import <span>;
+import <stdexcept>;
+import <string>;
+import GameController;
+
+namespace {
+
+constexpr std::uint32_t Modulus = 2147483647u;  // std::minstd_rand: x' = 48271 x mod (2^31 - 1)
+
+// a where m is 1, b where it is 0: a mask rather than a branch, which is
+// what keeps the lane loops below vectorizable.
+inline int pick(int m, int a, int b) {
+    return b ^ ((a ^ b) & -m);
+}
+
+// One std::minstd_rand step without a division: 48271 x < 2^47, and as
+// 2^31 = 1 (mod 2^31 - 1) the bits from 31 up fold onto the low ones,
+// leaving less than 2^32 (so the last reduction is in 32 bits).
+inline std::uint32_t nextRoll(std::uint32_t x) {
+    const std::uint64_t t = std::uint64_t{x} * 48271u;
+    const std::uint32_t folded = static_cast<std::uint32_t>((t & Modulus) + (t >> 31));
+    return folded >= Modulus ? folded - Modulus : folded;
+}
+
+inline bool isBuilding(SquareKind kind) {
+    return kind == SquareKind::Academic || kind == SquareKind::Residence || kind == SquareKind::Gym;
+}
+
+// What the player landing on square owes, from what was gathered about
+// the square and its owner: rent if charged (owned by someone else who is not
+// in the Tims line), Tuition (always-buy pays 10% of its total worth
+// while that is under $300) or the Coop Fee. Every table read happens
+// whatever the square, so a loop over lanes calling this needs no
+// branches.
+inline int owed(const BatchSquares& board, int square, int charged, int monopoly, int residences, int gyms,
+                int worth, int diceTotal) {
+    const SquareKind kind = board.kind[square];
+    const int residenceRent = board.residenceRent[residences];
+    const int gymRent = board.gymMultiplier[gyms] * diceTotal;
+    const int academicRent = board.baseRent[square] << monopoly;
+    const int rent = pick(kind == SquareKind::Residence, residenceRent,
+                          pick(kind == SquareKind::Gym, gymRent, academicRent));
+    return pick(kind == SquareKind::Tuition, std::min(worth / 10, 300),
+                pick(kind == SquareKind::CoopFee, 150, rent & -charged));
+}
+
+}  // namespace
+
+BatchEngine::BatchEngine(int games, int seats, unsigned firstSeed, const BoardDefinition& definition,
+                         int startMoney)
+    : lanes{games}, seatCount{seats}, definition{&definition} {
+    if (games < 1) throw std::invalid_argument("a batch needs at least one game");
+    if (seats < 2 || seats > MaxSeats) throw std::invalid_argument("a batch game has 2 to 8 seats");
+
+    for (int pos = 0; pos < BoardDefinition::Squares; ++pos) {
+        const SquareDefinition& square = definition.squares[pos];
+        squares.kind[pos] = square.kind;
+        squares.price[pos] = square.price;
+        if (square.kind == SquareKind::Academic) {
+            squares.baseRent[pos] = square.rent[0];
+            squares.block[pos] = definition.blocks.members(definition.blocks.blockOf(pos)).raw();
+        }
+    }
+    std::copy(definition.residenceRent.begin(), definition.residenceRent.end(), squares.residenceRent.begin());
+    std::copy(definition.gymMultiplier.begin(), definition.gymMultiplier.end(), squares.gymMultiplier.begin());
+
+    // Seeded like std::minstd_rand::seed (a multiple of the modulus means 1).
+    rng.resize(games);
+    for (int g = 0; g < games; ++g) {
+        std::uint32_t x = (firstSeed + static_cast<unsigned>(g)) % Modulus;
+        rng[g] = x == 0 ? 1 : x;
+    }
+    laneStatus.assign(games, LaneStatus::Playing);
+    stoppedAt.assign(games, 0);
+
+    const std::size_t rows = static_cast<std::size_t>(games) * seats;
+    positions.assign(rows, 0);
+    cash.assign(rows, startMoney);
+    propertyValue.assign(rows, 0);
+    tims.assign(rows, 0);
+    timsCount.assign(rows, 0);
+    holdings.assign(rows, 0);
+    residencesHeld.assign(rows, 0);
+    gymsHeld.assign(rows, 0);
+    owners.assign(static_cast<std::size_t>(games) * BoardDefinition::Squares, -1);
+    monopolies.assign(static_cast<std::size_t>(games) * BoardDefinition::Squares, 0);
+
+    for (auto* scratch : {&rolling, &jailed, &landing, &die1, &die2, &streak, &extraTurnAllowed, &creditor, &paid}) {
+        scratch->assign(games, 0);
+    }
+    pending.reserve(games);
+    for (int s = 0; s < seats; ++s) bidOrder[s] = s;
+}
+
+void BatchEngine::setTokens(std::span<const std::string> tokens) {
+    if (static_cast<int>(tokens.size()) != seatCount) throw std::invalid_argument("one token per seat");
+    for (int s = 0; s < seatCount; ++s) bidOrder[s] = s;
+    std::stable_sort(bidOrder.begin(), bidOrder.begin() + seatCount,
+                     [&](int a, int b) { return tokens[a] < tokens[b]; });
+}
+
+void BatchEngine::playTurn() {
+    // Plain pointers and a local count, so the stores below cannot be
+    // taken for writes to the vectors or to lanes.
+    const int n = lanes;
+    const int seat = turn % seatCount;
+    std::int32_t* const pos = positions.data() + at(seat, 0);
+    std::int32_t* const money = cash.data() + at(seat, 0);
+    std::int32_t* const value = propertyValue.data() + at(seat, 0);
+    std::int32_t* const inLine = tims.data() + at(seat, 0);
+    std::int32_t* const attempts = timsCount.data() + at(seat, 0);
+    const std::int32_t* const timsAll = tims.data();
+    const std::int32_t* const residencesAll = residencesHeld.data();
+    const std::int32_t* const gymsAll = gymsHeld.data();
+    const std::int32_t* const ownerAt = owners.data();
+    const std::int32_t* const monopolyAt = monopolies.data();
+    LaneStatus* const state = laneStatus.data();
+    std::int32_t* const stopTurn = stoppedAt.data();
+    std::uint32_t* const dice = rng.data();
+    std::int32_t* const roll = rolling.data();
+    std::int32_t* const jail = jailed.data();
+    std::int32_t* const land = landing.data();
+    std::int32_t* const first = die1.data();
+    std::int32_t* const second = die2.data();
+    std::int32_t* const run = streak.data();
+    std::int32_t* const extra = extraTurnAllowed.data();
+    std::int32_t* const to = creditor.data();
+    std::int32_t* const amount = paid.data();
+    const int now = turn;
+
+    // === Start of the turn: in the Tims line, $50 buys the way out
+    // (always-buy takes it whenever it has the cash) ===
+    int rollers = 0;
+#pragma GCC ivdep
+    for (int g = 0; g < n; ++g) {
+        const int on = state[g] == LaneStatus::Playing;
+        const int line = inLine[g];
+        const int pays = on & (line != 0) & (money[g] >= 50);
+        money[g] -= 50 * pays;
+        inLine[g] = line & -(pays ^ 1);
+        attempts[g] &= -(pays ^ 1);
+        jail[g] = on & (line != 0) & (pays ^ 1);
+        roll[g] = on;
+        run[g] = 0;
+        extra[g] = 1;
+        rollers += on;
+    }
+
+    while (rollers > 0) {
+        // === Dice, the Tims line attempt, three doubles, and the move ===
+#pragma GCC ivdep
+        for (int g = 0; g < n; ++g) {
+            const int on = roll[g];
+            const std::uint32_t seed = dice[g];
+            const int cashNow = money[g], line = inLine[g], tries = attempts[g];
+            const int from = pos[g], streakBefore = run[g];
+
+            const std::uint32_t a = nextRoll(seed);
+            const std::uint32_t b = nextRoll(a);
+            const int d1 = static_cast<int>(a % 6) + 1;
+            const int d2 = static_cast<int>(b % 6) + 1;
+            const int doubles = d1 == d2;
+
+            // In the line: doubles escape; the third miss pays $50 and
+            // moves anyway (or stops the lane: with $50 they would have
+            // paid up front); other misses end the turn.
+            const int inJail = on & jail[g];
+            const int lastTry = inJail & (doubles ^ 1) & (tries == 2);
+            const int broke = lastTry & (cashNow < 50);
+            const int waits = inJail & (doubles ^ 1) & (lastTry ^ 1);
+            const int leaves = inJail & (broke ^ 1) & (doubles | lastTry);
+
+            const int rolled = on & (inJail ^ 1);
+            const int streakNow = pick(rolled, (streakBefore + 1) & -doubles, streakBefore);
+            const int third = rolled & (streakNow == 3);
+
+            // Player::move, then OSAP for passing it (landing is paid below).
+            const int moves = on & ((broke | waits | third) ^ 1);
+            const int next = (from + d1 + d2) % 40;
+            const int osap = moves & (next < from) & (next != 0);
+
+            dice[g] = pick(on, static_cast<int>(b), static_cast<int>(seed));
+            first[g] = d1;
+            second[g] = d2;
+            money[g] = cashNow - 50 * (lastTry & (broke ^ 1)) + 200 * osap;
+            pos[g] = pick(third, 10, pick(moves, next, from));
+            inLine[g] = (line & -((leaves | third) ^ 1)) | third;
+            attempts[g] = (tries + waits) & -((third | leaves) ^ 1);
+            run[g] = streakNow;
+            extra[g] &= -((leaves | third) ^ 1);
+            state[g] = static_cast<LaneStatus>(static_cast<int>(state[g]) | broke);
+            stopTurn[g] = pick(broke, now, stopTurn[g]);
+            land[g] = moves;
+        }
+
+        // === The square: rent, Tuition or Coop Fee, OSAP, Go to Tims ===
+#pragma GCC ivdep
+        for (int g = 0; g < n; ++g) {
+            const int on = land[g];
+            const int cashNow = money[g], worth = cashNow + value[g];
+            const int square = pos[g] & -on;
+            const SquareKind kind = squares.kind[square];
+            const int owner = ownerAt[square * n + g];
+            const int theirs = pick(owner >= 0, owner, seat) * n + g;
+            const int charged = on & (owner >= 0) & (owner != seat) & (timsAll[theirs] == 0);
+            const int due = owed(squares, square, charged, monopolyAt[square * n + g], residencesAll[theirs],
+                                 gymsAll[theirs], worth, first[g] + second[g]) & -on;
+            const int covered = due <= cashNow;
+            const int osap = on & (kind == SquareKind::CollectOSAP);
+            const int sent = on & (kind == SquareKind::GoToTims);
+            const int building = (kind == SquareKind::Academic) | (kind == SquareKind::Residence) |
+                                 (kind == SquareKind::Gym);
+
+            money[g] = cashNow - (due & -covered) + 200 * osap;
+            amount[g] = due & -covered;
+            to[g] = pick(charged, owner, -1);
+            state[g] = static_cast<LaneStatus>(static_cast<int>(state[g]) | (covered ^ 1));
+            stopTurn[g] = pick(covered, stopTurn[g], now);
+            pos[g] = pick(sent, 10, pos[g]);
+            inLine[g] |= sent;
+            attempts[g] &= -(sent ^ 1);
+            extra[g] &= -(sent ^ 1);
+
+            // Unowned buildings, SLC and Needles Hall: one at a time below.
+            land[g] = on & ((building & (owner < 0)) | (kind == SquareKind::SLC) |
+                            (kind == SquareKind::NeedlesHall));
+        }
+
+        for (int other = 0; other < seatCount; ++other) {
+            if (other == seat) continue;
+            std::int32_t* const theirs = cash.data() + at(other, 0);
+#pragma GCC ivdep
+            for (int g = 0; g < n; ++g) theirs[g] += amount[g] & -(to[g] == other);
+        }
+
+        pending.clear();
+        for (int g = 0; g < n; ++g) {
+            if (land[g]) pending.push_back(g);
+        }
+        for (int g : pending) resolvePending(g, seat);
+
+        // === Doubles earn another roll ===
+        rollers = 0;
+#pragma GCC ivdep
+        for (int g = 0; g < n; ++g) {
+            const int again = roll[g] & (state[g] == LaneStatus::Playing) & (first[g] == second[g]) &
+                              extra[g] & (inLine[g] == 0);
+            roll[g] = again;
+            jail[g] = 0;
+            rollers += again;
+        }
+    }
+    ++turn;
+}
+
+// SLC and Needles Hall draw one more roll from the lane's sequence, like
+// the controller; an unowned building is bought, or auctioned when the
+// mover cannot afford it (every seat's maximum is the price, capped at
+// its cash, and the Bank never keeps it).
+void BatchEngine::resolvePending(int game, int seat) {
+    const int i = at(seat, game);
+    const int square = positions[i];
+    switch (squares.kind[square]) {
+        case SquareKind::SLC: {
+            rng[game] = nextRoll(rng[game]);
+            const SlcOutcome& card = definition->slc.draw(static_cast<int>(rng[game]));
+            if (card.effect == SlcEffect::GoToTims) {
+                positions[i] = 10;
+                tims[i] = 1;
+                timsCount[i] = 0;
+                extraTurnAllowed[game] = 0;
+            } else if (card.effect == SlcEffect::CollectOSAP) {
+                positions[i] = 0;  // moved there, not landed: nothing paid
+            } else {
+                positions[i] = (square + card.move) % 40;
+            }
+            break;
+        }
+        case SquareKind::NeedlesHall: {
+            rng[game] = nextRoll(rng[game]);
+            const int delta = definition->needlesHall.draw(static_cast<int>(rng[game]));
+            if (delta >= 0 || cash[i] >= -delta) {
+                cash[i] += delta;
+            } else {
+                stop(game);
+            }
+            break;
+        }
+        default: {
+            const int price = squares.price[square];
+            if (cash[i] >= price) {
+                take(game, seat, square, price);
+                break;
+            }
+            std::array<int, MaxSeats> maxima{};
+            for (int k = 0; k < seatCount; ++k) {
+                maxima[k] = std::clamp(price, 0, std::max(0, cash[at(bidOrder[k], game)]));
+            }
+            AuctionResult result = GameController::resolveProxyAuction(
+                std::span<const int>{maxima.data(), static_cast<std::size_t>(seatCount)}, AuctionMode::ProxyEnglish);
+            take(game, bidOrder[result.winner], square, result.price);
+        }
+    }
+}
+
+void BatchEngine::take(int game, int seat, int square, int price) {
+    cash[at(seat, game)] -= price;
+    setOwner(game, square, seat);
+}
+
+int BatchEngine::amountDue(int game, int seat, int square, int diceTotal) const {
+    const int owner = owners[square * lanes + game];
+    const int theirs = at(owner < 0 ? seat : owner, game);
+    const int mine = at(seat, game);
+    const bool charged = owner >= 0 && owner != seat && !tims[theirs];
+    return owed(squares, square, charged, monopolies[square * lanes + game], residencesHeld[theirs],
+                gymsHeld[theirs], cash[mine] + propertyValue[mine], diceTotal);
+}
+
+void BatchEngine::setOwner(int game, int square, int seat) {
+    if (!isBuilding(squares.kind[square])) {
+        throw std::invalid_argument("square " + std::to_string(square) + " is not a building");
+    }
+    std::int32_t& slot = owners[square * lanes + game];
+    if (slot == seat) return;
+
+    const std::uint64_t bit = std::uint64_t{1} << square;
+    const bool residence = squares.kind[square] == SquareKind::Residence;
+    const bool gym = squares.kind[square] == SquareKind::Gym;
+    if (slot >= 0) {
+        const int old = at(slot, game);
+        holdings[old] &= ~bit;
+        propertyValue[old] -= squares.price[square];
+        residencesHeld[old] -= residence;
+        gymsHeld[old] -= gym;
+    }
+    slot = seat;
+    if (seat >= 0) {
+        const int now = at(seat, game);
+        holdings[now] |= bit;
+        propertyValue[now] += squares.price[square];
+        residencesHeld[now] += residence;
+        gymsHeld[now] += gym;
+    }
+
+    // Every square of the block shares its flag: all one owner's, or not.
+    const std::uint64_t block = squares.block[square];
+    const bool monopoly = seat >= 0 && block && (holdings[at(seat, game)] & block) == block;
+    for (int pos = 0; pos < BoardDefinition::Squares; ++pos) {
+        if (block >> pos & 1) monopolies[pos * lanes + game] = monopoly;
+    }
+}
+
+void BatchEngine::setInTims(int game, int seat, bool inTims) {
+    tims[at(seat, game)] = inTims;
+    timsCount[at(seat, game)] = 0;
+}
+
+void BatchEngine::setMoney(int game, int seat, int amount) {
+    cash[at(seat, game)] = amount;
+}
+
+void BatchEngine::stop(int game) {
+    laneStatus[game] = LaneStatus::Shortfall;
+    stoppedAt[game] = turn;
+}
+
+int BatchEngine::games() const {
+    return lanes;
+}
+
+int BatchEngine::seats() const {
+    return seatCount;
+}
+
+int BatchEngine::playing() const {
+    return static_cast<int>(std::count(laneStatus.begin(), laneStatus.end(), LaneStatus::Playing));
+}
+
+LaneStatus BatchEngine::status(int game) const {
+    return laneStatus[game];
+}
+
+int BatchEngine::turnsPlayed(int game) const {
+    return laneStatus[game] == LaneStatus::Playing ? turn : stoppedAt[game];
+}
+
+int BatchEngine::currentSeat(int game) const {
+    return turnsPlayed(game) % seatCount;
+}
+
+int BatchEngine::position(int game, int seat) const {
+    return positions[at(seat, game)];
+}
+
+int BatchEngine::money(int game, int seat) const {
+    return cash[at(seat, game)];
+}
+
+bool BatchEngine::inTims(int game, int seat) const {
+    return tims[at(seat, game)];
+}
+
+int BatchEngine::timsTurns(int game, int seat) const {
+    return timsCount[at(seat, game)];
+}
+
+int BatchEngine::owner(int game, int square) const {
+    return owners[square * lanes + game];
+}
@@ -0,0 +1,167 @@
+// Batch-Engine.cc (interface)
+// Module: BatchEngine
+// Description:
+//   Plays many independent games in lockstep, for bulk simulation where
+//   one Game per simulated game (objects, virtual calls, console output)
+//   costs more than the game logic itself.
+//
+//   Every game ("lane") has the same number of seats and is played by the
+//   always-buy policy with proxy English auctions, i.e. exactly what
+//   GameController::playTurn does when every seat has AlwaysBuyStrategy
+//   and the auction mode is AuctionMode::ProxyEnglish. Lane g seeds its
+//   dice with firstSeed + g and draws them, the SLC cards and the Needles
+//   Hall amounts from its own std::minstd_rand sequence in the controller's
+//   order, and takes auction bids in the Game's token order (setTokens),
+//   which decides tied maxima, so a lane and a Game seeded alike play the
+//   same game roll for roll:
+//   Player::move's `(position + steps) % 40` (including the -1 left
+//   by an SLC -3 from square 2), OSAP paid when passing it and when
+//   landing on it, rent as stepResolve computes it (monopoly doubling,
+//   residences owned, gym multiplier times the dice, nothing while the
+//   owner is in the Tims line), Tuition, Coop Fee, three doubles, and the
+//   Tims line rules.
+//
+//   Nobody goes bankrupt inside the batch (see below), so every lane is
+//   always on the same seat's turn. State is structure-of-arrays: each
+//   field is an array over lanes, one per seat (or per square for the owner
+//   table), so the player to move is a contiguous row. A turn is a few
+//   passes over those rows in which every lane does the same work and
+//   differences are masks rather than branches, so the compiler can
+//   vectorize them: leaving or staying in the Tims line, the dice
+//   (minstd_rand without a division), the move modulo 40 with OSAP
+//   detection, and the rent / fee lookup and payment. A lane that rolled
+//   doubles is masked in for the next roll; lanes that land on something
+//   needing more than a lookup (an unowned building and its auction, SLC,
+//   Needles Hall) are compacted into a list and finished one at a time.
+//
+//   What the batch does not model stops a lane instead: when a payment is
+//   more than the player's cash, GameController would run the liquidation
+//   planner (and perhaps bankruptcy), so the lane's status becomes
+//   Shortfall and its state is left as it was just before that payment.
+//   Up to that point no building is ever improved or mortgaged and nobody
+//   holds a Roll Up the Rim cup, so the batch keeps none of those.
+//
+// Related Modules:
+//   - GameController (the turn it reproduces; resolveProxyAuction)
+//   - BoardDefinition (squares, rents and chance tables it reads)
+//   - Strategy (AlwaysBuyStrategy, the policy it plays)
+
+export module BatchEngine;
+
+import <array>;
+import <cstdint>;
+import <span>;
+import <string>;
+import <vector>;
+import BoardDefinition;
+
+// The numbers the batch reads per square, from a BoardDefinition. The
+// rent tables are indexed by the number owned and hold 0 past the end of
+// the definition's, as Residence::calculateRent and Gym::getMultiplier
+// return.
+struct BatchSquares {
+    std::array<SquareKind, BoardDefinition::Squares> kind{};
+    std::array<int, BoardDefinition::Squares> price{};
+    std::array<int, BoardDefinition::Squares> baseRent{};       // academic: rent with no improvements
+    std::array<std::uint64_t, BoardDefinition::Squares> block{};  // academic: its block's members
+    std::array<int, BoardDefinition::Squares + 1> residenceRent{};
+    std::array<int, BoardDefinition::Squares + 1> gymMultiplier{};
+};
+
+export enum class LaneStatus : std::uint8_t {
+    Playing,
+    Shortfall,   // stopped before a payment its player could not cover
+};
+
+export class BatchEngine {
+public:
+    static constexpr int MaxSeats = 8;
+
+    // games lanes of seats players each, every player on OSAP with
+    // startMoney and the Bank owning everything. Throws
+    // std::invalid_argument unless games >= 1 and 2 <= seats <= MaxSeats.
+    BatchEngine(int games, int seats, unsigned firstSeed,
+                const BoardDefinition& definition = standardBoardDefinition(), int startMoney = 1500);
+
+    // Every playing lane plays the next seat's whole turn, doubles
+    // re-rolls included (seats take turns 0, 1, ..., seats - 1, 0, ...).
+    void playTurn();
+
+    int games() const;
+    int seats() const;
+    int playing() const;                   // lanes whose status is Playing
+
+    LaneStatus status(int game) const;
+    // Completed turns, all seats together; a stopped lane counts those
+    // before the one it stopped in, and currentSeat is that turn's seat.
+    int turnsPlayed(int game) const;
+    int currentSeat(int game) const;
+
+    int position(int game, int seat) const;
+    int money(int game, int seat) const;
+    bool inTims(int game, int seat) const;
+    int timsTurns(int game, int seat) const;
+    int owner(int game, int square) const;  // seat, or -1 for the Bank
+
+    // Setting up a position between turns. seat -1 gives square back to
+    // the Bank.
+    void setOwner(int game, int square, int seat);
+    void setInTims(int game, int seat, bool inTims);
+    void setMoney(int game, int seat, int amount);
+
+    // The Game's tokens, seat by seat. GameController takes auction bids
+    // in token order, so every lane does the same from now on; until
+    // then seats bid in seat order. Throws std::invalid_argument unless
+    // there is one token per seat.
+    void setTokens(std::span<const std::string> tokens);
+
+    // What seat would pay (to the owner, or the Bank for Tuition and the
+    // Coop Fee) for landing on square with this dice total; 0 when
+    // nothing is owed. The same lookup step() uses.
+    int amountDue(int game, int seat, int square, int diceTotal) const;
+
+private:
+    int lanes;
+    int seatCount;
+    int turn = 0;                          // turns completed by playing lanes
+    const BoardDefinition* definition;
+    std::array<int, MaxSeats> bidOrder{};  // seats in the order they bid
+
+    BatchSquares squares;
+
+    // Per lane (index game).
+    std::vector<std::uint32_t> rng;
+    std::vector<LaneStatus> laneStatus;
+    std::vector<std::int32_t> stoppedAt;       // turnsPlayed of a stopped lane
+
+    // Per lane and seat (index seat * games + game).
+    std::vector<std::int32_t> positions;
+    std::vector<std::int32_t> cash;
+    std::vector<std::int32_t> propertyValue;   // list prices of what the seat owns
+    std::vector<std::int32_t> tims;
+    std::vector<std::int32_t> timsCount;
+    std::vector<std::uint64_t> holdings;       // PropertySet bits
+    std::vector<std::int32_t> residencesHeld;
+    std::vector<std::int32_t> gymsHeld;
+
+    // Per lane and square (index square * games + game).
+    std::vector<std::int32_t> owners;          // seat, or -1
+    std::vector<std::int32_t> monopolies;      // academic: its owner holds the whole block
+
+    // Scratch for one turn (index game).
+    std::vector<std::int32_t> rolling;         // rolls (again) this pass
+    std::vector<std::int32_t> jailed;          // rolling for doubles in the Tims line
+    std::vector<std::int32_t> landing;         // moved; then: left for the one-at-a-time pass
+    std::vector<std::int32_t> die1;
+    std::vector<std::int32_t> die2;
+    std::vector<std::int32_t> streak;          // doubles rolled so far this turn
+    std::vector<std::int32_t> extraTurnAllowed;
+    std::vector<std::int32_t> creditor;        // seat the amount due goes to, or -1
+    std::vector<std::int32_t> paid;
+    std::vector<std::int32_t> pending;         // lanes left for the one-at-a-time pass
+
+    inline int at(int seat, int game) const { return seat * lanes + game; }
+    void stop(int game);
+    void take(int game, int seat, int square, int price);
+    void resolvePending(int game, int seat);
+};
@@ -0,0 +1,39 @@
+// Block-Index-impl.cc (implementation)
+// Module: BlockIndex
+// Description:
+//   Construction-time registration of blocks and their members. The
+//   per-query accessors (and all of BlockIndex) are inline in the interface.
+
+module BlockIndex;
+
+BlockLayout::BlockLayout() {
+    blockAt.fill(None);
+}
+
+int BlockLayout::addBlock(const std::string& name) {
+    int id = find(name);
+    if (id != None) return id;
+
+    names[count] = name;
+    return count++;
+}
+
+void BlockLayout::addMember(int block, int position) {
+    blockAt[position] = block;
+    masks[block].insert(position);
+}
+
+int BlockLayout::find(const std::string& name) const {
+    for (int i = 0; i < count; ++i) {
+        if (names[i] == name) return i;
+    }
+    return None;
+}
+
+const std::string& BlockLayout::name(int block) const {
+    return names[block];
+}
+
+int BlockLayout::size() const {
+    return count;
+}
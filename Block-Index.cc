@@ -0,0 +1,88 @@
+// Block-Index.cc (interface)
+// Module: BlockIndex
+// Description:
+//   Monopoly block index. BlockLayout is built once per board definition:
+//   each block (e.g. "Arts1", "Math") gets a small integer ID mapping to
+//   the PropertySet of its 2–3 member positions. Each game's BlockIndex
+//   reads that shared layout and keeps a running count of improvements
+//   per block (AcademicBuilding updates it whenever its own level changes).
+//
+//   This turns the common validation questions into O(block size) bit
+//   operations with no string comparisons:
+//     - "does this owner hold the whole block"   -> ownsAll()
+//     - "does any building in the block have improvements" -> improvements()
+//
+// Related Modules:
+//   - BoardDefinition (builds the layout)
+//   - BoardState (holds each game's index)
+//   - AcademicBuilding (knows its block ID; reports improvement changes)
+//   - GameController, Liquidation, TradeEngine (query it)
+
+export module BlockIndex;
+
+import <array>;
+import <cstdint>;
+import <string>;
+import PropertySet;
+
+// The static part: which squares form which block. Built once per board
+// definition and shared by every game on that layout.
+export class BlockLayout {
+public:
+    static constexpr int None = -1;  // position is not in any block
+    static constexpr int MaxBlocks = 40;  // at most one block per square
+
+    BlockLayout();
+
+    // Returns the ID for a block name, registering it if new.
+    int addBlock(const std::string& name);
+
+    // Records that the square at position belongs to block.
+    void addMember(int block, int position);
+
+    // ID of a block by name, or None. Only for string-facing entry points.
+    int find(const std::string& name) const;
+
+    const std::string& name(int block) const;
+    int size() const;
+
+    inline int blockOf(int position) const { return blockAt[position]; }
+    inline PropertySet members(int block) const { return masks[block]; }
+    inline bool ownsAll(PropertySet owned, int block) const {
+        return (owned & masks[block]) == masks[block];
+    }
+
+    bool operator==(const BlockLayout&) const = default;
+
+private:
+    // Fixed capacity, so building a layout never touches the heap.
+    std::array<int, 40> blockAt;
+    std::array<PropertySet, MaxBlocks> masks{};
+    std::array<std::string, MaxBlocks> names;
+    int count = 0;
+};
+
+// One game's view of a shared layout: the same queries, plus the running
+// improvement count per block (the only part that changes during play).
+export class BlockIndex {
+public:
+    static constexpr int None = BlockLayout::None;
+    static constexpr int MaxBlocks = BlockLayout::MaxBlocks;
+
+    explicit BlockIndex(const BlockLayout& layout) : layout{&layout} {}
+
+    inline int find(const std::string& name) const { return layout->find(name); }
+    inline const std::string& name(int block) const { return layout->name(block); }
+    inline int size() const { return layout->size(); }
+    inline int blockOf(int position) const { return layout->blockOf(position); }
+    inline PropertySet members(int block) const { return layout->members(block); }
+    inline bool ownsAll(PropertySet owned, int block) const { return layout->ownsAll(owned, block); }
+
+    // Improvements currently built anywhere in the block.
+    inline int improvements(int block) const { return improvementCounts[block]; }
+    inline void adjustImprovements(int block, int delta) { improvementCounts[block] += delta; }
+
+private:
+    const BlockLayout* layout;
+    std::array<std::uint8_t, MaxBlocks> improvementCounts{};  // at most 5 per member
+};
@@ -0,0 +1,318 @@
+// Board-Definition-impl.cc (implementation)
+// Module: BoardDefinition
+// Description:
+//   The built-in board as a definition, the board file parser, and the
+//   validation shared by both.
+
+module BoardDefinition;
+
+import <fstream>;
+import <iomanip>;
+import <set>;
+import <sstream>;
+import <stdexcept>;
+import SquareNames;
+
+namespace {
+
+SquareDefinition special(SquareKind kind, std::string name) {
+    SquareDefinition sq;
+    sq.kind = kind;
+    sq.name = std::move(name);
+    return sq;
+}
+
+SquareDefinition academic(std::string name, int price, std::string block, int cost,
+                          std::array<int, 6> rent) {
+    SquareDefinition sq;
+    sq.kind = SquareKind::Academic;
+    sq.name = std::move(name);
+    sq.price = price;
+    sq.block = std::move(block);
+    sq.improvementCost = cost;
+    sq.rent = rent;
+    return sq;
+}
+
+SquareDefinition ownable(SquareKind kind, std::string name, int price) {
+    SquareDefinition sq = special(kind, std::move(name));
+    sq.price = price;
+    return sq;
+}
+
+BoardDefinition buildStandard() {
+    using K = SquareKind;
+    BoardDefinition def;
+    def.squares = {{
+        special(K::CollectOSAP, "COLLECT OSAP"),
+        academic("AL", 40, "Arts1", 50, {2, 10, 30, 90, 160, 250}),
+        special(K::SLC, "SLC"),
+        academic("ML", 60, "Arts1", 50, {4, 20, 60, 180, 320, 450}),
+        special(K::Tuition, "TUITION"),
+        ownable(K::Residence, "MKV", 200),
+        academic("ECH", 100, "Arts2", 50, {6, 30, 90, 270, 400, 550}),
+        special(K::NeedlesHall, "NEEDLES HALL"),
+        academic("PAS", 100, "Arts2", 50, {6, 30, 90, 270, 400, 550}),
+        academic("HH", 120, "Arts2", 50, {8, 40, 100, 300, 450, 600}),
+        special(K::DCTimsLine, "DC Tims Line"),
+        academic("RCH", 140, "Eng", 100, {10, 50, 150, 450, 625, 750}),
+        ownable(K::Gym, "PAC", 150),
+        academic("DWE", 140, "Eng", 100, {10, 50, 150, 450, 625, 750}),
+        academic("CPH", 160, "Eng", 100, {12, 60, 180, 500, 700, 900}),
+        ownable(K::Residence, "UWP", 200),
+        academic("LHI", 180, "Health", 100, {14, 70, 200, 550, 750, 950}),
+        special(K::SLC, "SLC"),
+        academic("BMH", 180, "Health", 100, {14, 70, 200, 550, 750, 950}),
+        academic("OPT", 200, "Health", 100, {16, 80, 220, 600, 800, 1000}),
+        special(K::GooseNesting, "Goose Nesting"),
+        academic("EV1", 220, "Env", 150, {18, 90, 250, 700, 875, 1050}),
+        special(K::NeedlesHall, "NEEDLES HALL"),
+        academic("EV2", 220, "Env", 150, {18, 90, 250, 700, 875, 1050}),
+        academic("EV3", 240, "Env", 150, {20, 100, 300, 750, 925, 1100}),
+        ownable(K::Residence, "V1", 200),
+        academic("PHYS", 260, "Sci1", 150, {22, 110, 330, 800, 975, 1150}),
+        academic("B1", 260, "Sci1", 150, {22, 110, 330, 800, 975, 1150}),
+        ownable(K::Gym, "CIF", 150),
+        academic("B2", 280, "Sci1", 150, {24, 120, 360, 850, 1025, 1200}),
+        special(K::GoToTims, "GO TO TIMS"),
+        academic("EIT", 300, "Sci2", 200, {26, 130, 390, 900, 1100, 1275}),
+        academic("ESC", 300, "Sci2", 200, {26, 130, 390, 900, 1100, 1275}),
+        special(K::SLC, "SLC"),
+        academic("C2", 320, "Sci2", 200, {28, 150, 450, 1000, 1200, 1400}),
+        ownable(K::Residence, "REV", 200),
+        special(K::NeedlesHall, "NEEDLES HALL"),
+        academic("MC", 350, "Math", 200, {35, 175, 500, 1100, 1300, 1500}),
+        special(K::CoopFee, "COOP FEE"),
+        academic("DC", 400, "Math", 200, {50, 200, 600, 1400, 1700, 2000}),
+    }};
+    def.residenceRent = {0, 25, 50, 100, 200};
+    // Gym rent is (gyms owned) x (dice total).
+    def.gymMultiplier = {0, 1, 2};
+
+    def.slc.add({SlcEffect::GoToTims, 0}, 1);
+    def.slc.add({SlcEffect::CollectOSAP, 0}, 1);
+    def.slc.add({SlcEffect::Move, -3}, 3);
+    def.slc.add({SlcEffect::Move, -2}, 4);
+    def.slc.add({SlcEffect::Move, -1}, 4);
+    def.slc.add({SlcEffect::Move, 1}, 3);
+    def.slc.add({SlcEffect::Move, 2}, 4);
+    def.slc.add({SlcEffect::Move, 3}, 4);
+
+    def.needlesHall.add(-200, 1);
+    def.needlesHall.add(-100, 2);
+    def.needlesHall.add(-50, 3);
+    def.needlesHall.add(25, 6);
+    def.needlesHall.add(50, 3);
+    def.needlesHall.add(100, 2);
+    def.needlesHall.add(200, 1);
+    return def;
+}
+
+bool isOwnable(SquareKind kind) {
+    return kind == SquareKind::Academic || kind == SquareKind::Residence || kind == SquareKind::Gym;
+}
+
+[[noreturn]] void fail(const std::string& message) {
+    throw std::runtime_error(message);
+}
+
+// Parses "osap", "academic", ... (the file's kind keywords).
+bool parseKind(const std::string& word, SquareKind& kind) {
+    static const std::pair<const char*, SquareKind> keywords[] = {
+        {"osap", SquareKind::CollectOSAP},   {"academic", SquareKind::Academic},
+        {"residence", SquareKind::Residence}, {"gym", SquareKind::Gym},
+        {"slc", SquareKind::SLC},             {"tuition", SquareKind::Tuition},
+        {"needles", SquareKind::NeedlesHall}, {"tims", SquareKind::DCTimsLine},
+        {"goose", SquareKind::GooseNesting},  {"gototims", SquareKind::GoToTims},
+        {"coop", SquareKind::CoopFee},
+    };
+    for (const auto& [keyword, k] : keywords) {
+        if (word == keyword) {
+            kind = k;
+            return true;
+        }
+    }
+    return false;
+}
+
+}  // namespace
+
+void BoardDefinition::validate() const {
+    auto at = [](int pos) { return "square " + std::to_string(pos) + ": "; };
+
+    if (squares[0].kind != SquareKind::CollectOSAP) fail(at(0) + "must be the Collect OSAP square");
+    if (squares[10].kind != SquareKind::DCTimsLine) fail(at(10) + "must be the DC Tims Line square");
+
+    std::set<std::string> ownableNames;
+    int residences = 0, gyms = 0;
+    for (int pos = 0; pos < Squares; ++pos) {
+        const SquareDefinition& sq = squares[pos];
+        if (sq.name.empty()) fail(at(pos) + "is not defined");
+        if (!isOwnable(sq.kind)) continue;
+
+        // Save files and commands read building names as single words.
+        if (sq.name.find_first_of(" \t") != std::string::npos) {
+            fail(at(pos) + "property name \"" + sq.name + "\" contains whitespace");
+        }
+        if (!ownableNames.insert(sq.name).second) fail(at(pos) + "duplicate property name " + sq.name);
+        if (sq.price <= 0) fail(at(pos) + "price must be positive");
+
+        if (sq.kind == SquareKind::Residence) ++residences;
+        if (sq.kind == SquareKind::Gym) ++gyms;
+        if (sq.kind != SquareKind::Academic) continue;
+
+        if (sq.block.empty()) fail(at(pos) + "academic building has no block");
+        if (sq.improvementCost <= 0) fail(at(pos) + "improvement cost must be positive");
+        for (int level = 0; level < 6; ++level) {
+            if (sq.rent[level] < 0) fail(at(pos) + "rent must not be negative");
+            if (level > 0 && sq.rent[level] < sq.rent[level - 1]) {
+                fail(at(pos) + "rent must not decrease with improvements");
+            }
+        }
+    }
+
+    if (residences > 4) fail("at most 4 residences are supported");
+    if (gyms > 2) fail("at most 2 gyms are supported");
+    for (int n = 1; n <= 4; ++n) {
+        if (residenceRent[n] < 0) fail("residence rent must not be negative");
+    }
+    for (int n = 1; n <= 2; ++n) {
+        if (gymMultiplier[n] < 0) fail("gym multiplier must not be negative");
+    }
+
+    if (slc.totalWeight() == 0) fail("SLC has no outcomes");
+    if (needlesHall.totalWeight() == 0) fail("Needles Hall has no outcomes");
+    for (int i = 0; i < slc.size(); ++i) {
+        const SlcOutcome& o = slc.outcome(i);
+        if (o.effect == SlcEffect::Move && (o.move == 0 || o.move <= -Squares || o.move >= Squares)) {
+            fail("SLC move offset must be between -39 and 39 and not 0");
+        }
+    }
+}
+
+void BoardDefinition::compile() {
+    validate();
+
+    blocks = {};
+    residences = {};
+    gyms = {};
+    for (int pos = 0; pos < Squares; ++pos) {
+        const SquareDefinition& sq = squares[pos];
+        if (sq.kind == SquareKind::Academic) blocks.addMember(blocks.addBlock(sq.block), pos);
+        if (sq.kind == SquareKind::Residence) residences.insert(pos);
+        if (sq.kind == SquareKind::Gym) gyms.insert(pos);
+    }
+
+    // Name lookups can use the perfect hash only if every square is where
+    // the standard table says.
+    standardNames = true;
+    for (const SquareDefinition& sq : squares) {
+        int first = canonicalSquareIndex(sq.name);
+        if (first < 0 || squares[first].name != sq.name) standardNames = false;
+    }
+}
+
+const BoardDefinition& standardBoardDefinition() {
+    static const BoardDefinition standard = [] {
+        BoardDefinition def = buildStandard();
+        def.compile();
+        return def;
+    }();
+    return standard;
+}
+
+BoardDefinition loadBoardDefinition(const std::string& path) {
+    std::ifstream in(path);
+    if (!in) fail("cannot open board file " + path);
+
+    BoardDefinition def;
+    bool haveResidenceRent = false, haveGymMultiplier = false;
+    std::array<bool, BoardDefinition::Squares> seen{};
+
+    std::string line;
+    for (int lineNo = 1; std::getline(in, line); ++lineNo) {
+        auto error = [&](const std::string& message) {
+            fail(path + ":" + std::to_string(lineNo) + ": " + message);
+        };
+        if (auto hash = line.find('#'); hash != std::string::npos) line.erase(hash);
+
+        std::istringstream ss(line);
+        std::string record;
+        if (!(ss >> record)) continue;
+
+        if (record == "square") {
+            int pos;
+            std::string kindWord;
+            SquareKind kind{};
+            if (!(ss >> pos)) error("expected a position");
+            if (pos < 0 || pos >= BoardDefinition::Squares) error("position out of range");
+            if (seen[pos]) error("square " + std::to_string(pos) + " defined twice");
+            if (!(ss >> kindWord) || !parseKind(kindWord, kind)) error("unknown square kind '" + kindWord + "'");
+
+            SquareDefinition sq;
+            sq.kind = kind;
+            if (!(ss >> std::quoted(sq.name))) error("expected a name");
+            if (kind == SquareKind::Academic) {
+                if (!(ss >> sq.price >> sq.block >> sq.improvementCost)) {
+                    error("expected <price> <block> <improvementCost>");
+                }
+                for (int& r : sq.rent) {
+                    if (!(ss >> r)) error("expected 6 rent values");
+                }
+            } else if (isOwnable(kind)) {
+                if (!(ss >> sq.price)) error("expected a price");
+            }
+            def.squares[pos] = std::move(sq);
+            seen[pos] = true;
+        } else if (record == "residence-rent") {
+            for (int n = 1; n <= 4; ++n) {
+                if (!(ss >> def.residenceRent[n])) error("expected 4 residence rents");
+            }
+            haveResidenceRent = true;
+        } else if (record == "gym-multiplier") {
+            for (int n = 1; n <= 2; ++n) {
+                if (!(ss >> def.gymMultiplier[n])) error("expected 2 gym multipliers");
+            }
+            haveGymMultiplier = true;
+        } else if (record == "slc") {
+            std::string effect;
+            SlcOutcome outcome;
+            int weight = 0;
+            ss >> effect;
+            if (effect == "tims") outcome.effect = SlcEffect::GoToTims;
+            else if (effect == "osap") outcome.effect = SlcEffect::CollectOSAP;
+            else if (effect == "move") {
+                if (!(ss >> outcome.move)) error("expected a move offset");
+            } else error("unknown SLC outcome '" + effect + "'");
+            if (!(ss >> weight) || weight <= 0) error("expected a positive weight");
+            if (def.slc.totalWeight() + weight > 10000) error("SLC weights add up to more than 10000");
+            def.slc.add(outcome, weight);
+        } else if (record == "needles") {
+            int amount = 0, weight = 0;
+            if (!(ss >> amount >> weight) || weight <= 0) error("expected <amount> <positive weight>");
+            if (def.needlesHall.totalWeight() + weight > 10000) {
+                error("Needles Hall weights add up to more than 10000");
+            }
+            def.needlesHall.add(amount, weight);
+        } else {
+            error("unknown record '" + record + "'");
+        }
+
+        std::string extra;
+        if (ss >> extra) error("unexpected '" + extra + "'");
+    }
+
+    // Rules a variant leaves out are the standard board's.
+    const BoardDefinition& standard = standardBoardDefinition();
+    if (!haveResidenceRent) def.residenceRent = standard.residenceRent;
+    if (!haveGymMultiplier) def.gymMultiplier = standard.gymMultiplier;
+    if (def.slc.totalWeight() == 0) def.slc = standard.slc;
+    if (def.needlesHall.totalWeight() == 0) def.needlesHall = standard.needlesHall;
+
+    try {
+        def.compile();
+    } catch (const std::runtime_error& e) {
+        fail(path + ": " + e.what());
+    }
+    return def;
+}
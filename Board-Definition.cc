@@ -0,0 +1,139 @@
+// Board-Definition.cc (interface)
+// Module: BoardDefinition
+// Description:
+//   Everything that distinguishes one Watopoly board variant from another,
+//   as plain position-indexed tables: each square's kind, name, price,
+//   monopoly block, improvement cost and rent ladder; the residence rent
+//   per number owned; the gym dice multiplier per number owned; and the
+//   Needles Hall and SLC outcome distributions.
+//
+//   A definition comes either from standardBoardDefinition() (the built-in
+//   board) or from loadBoardDefinition(path) (a text file, see below). Both
+//   are validated and compiled the same way, so the engine reads the same
+//   flat tables either way: Board builds its squares from them, buildings
+//   read their names, prices and rent ladders from them, and the chance
+//   squares draw from roll-indexed outcome tables (one array load per draw).
+//
+//   A compiled definition is immutable and shared: every Board built from
+//   it (any number of concurrent games) points at the same copy, and only
+//   keeps its own BoardState.
+//
+//   File format: one record per line, '#' starts a comment, names that
+//   contain spaces are double-quoted.
+//     square <pos> osap|slc|tuition|needles|tims|goose|gototims|coop <name>
+//     square <pos> academic <name> <price> <block> <improvementCost> <r0> .. <r5>
+//     square <pos> residence|gym <name> <price>
+//     residence-rent <1 owned> <2 owned> <3 owned> <4 owned>
+//     gym-multiplier <1 owned> <2 owned>
+//     slc tims|osap <weight>
+//     slc move <offset> <weight>
+//     needles <amount> <weight>
+//
+// Related Modules:
+//   - Board (constructs its squares from a definition)
+//   - ActionSquares (SLC draws from the compiled SLC table)
+//   - GameController (Needles Hall, gym multipliers)
+
+export module BoardDefinition;
+
+import <array>;
+import <cstdint>;
+import <string>;
+import <vector>;
+import BlockIndex;
+import PropertySet;
+
+export enum class SquareKind {
+    CollectOSAP,
+    Academic,
+    Residence,
+    Gym,
+    SLC,
+    Tuition,
+    NeedlesHall,
+    DCTimsLine,
+    GooseNesting,
+    GoToTims,
+    CoopFee
+};
+
+export struct SquareDefinition {
+    SquareKind kind = SquareKind::GooseNesting;
+    std::string name;
+    int price = 0;                 // ownable squares only
+    std::string block;             // academic buildings only
+    int improvementCost = 0;       // academic buildings only
+    std::array<int, 6> rent{};     // academic: rent at 0-5 improvements
+
+    bool operator==(const SquareDefinition&) const = default;
+};
+
+export enum class SlcEffect { Move, GoToTims, CollectOSAP };
+
+export struct SlcOutcome {
+    SlcEffect effect = SlcEffect::Move;
+    int move = 0;                  // offset for SlcEffect::Move
+
+    bool operator==(const SlcOutcome&) const = default;
+};
+
+// Weighted outcomes compiled into a roll -> outcome table. draw(r) uses
+// r % totalWeight, so a distribution whose weights add up to N consumes
+// one roll exactly like a hand-written `roll % N` ladder.
+export template <typename Outcome>
+class ChanceTable {
+private:
+    std::vector<Outcome> outcomes;
+    std::vector<int> weights;
+    std::vector<std::uint16_t> byRoll;  // roll -> index into outcomes
+
+public:
+    void add(const Outcome& outcome, int weight) {
+        outcomes.push_back(outcome);
+        weights.push_back(weight);
+        byRoll.insert(byRoll.end(), weight, static_cast<std::uint16_t>(outcomes.size() - 1));
+    }
+
+    const Outcome& draw(int roll) const {
+        return outcomes[byRoll[static_cast<unsigned>(roll) % byRoll.size()]];
+    }
+
+    int totalWeight() const { return static_cast<int>(byRoll.size()); }
+    int size() const { return static_cast<int>(outcomes.size()); }
+    const Outcome& outcome(int i) const { return outcomes[i]; }
+    int weight(int i) const { return weights[i]; }
+
+    bool operator==(const ChanceTable&) const = default;
+};
+
+export struct BoardDefinition {
+    static constexpr int Squares = 40;
+
+    std::array<SquareDefinition, Squares> squares;
+    std::array<int, 5> residenceRent{};   // by residences owned (0 unused)
+    std::array<int, 3> gymMultiplier{};   // dice multiplier by gyms owned (0 unused)
+    ChanceTable<SlcOutcome> slc;
+    ChanceTable<int> needlesHall;         // money change
+
+    // Derived by compile(); read by Board and the buildings.
+    BlockLayout blocks;                   // academic blocks and their members
+    PropertySet residences;               // positions of residences
+    PropertySet gyms;                     // positions of gyms
+    bool standardNames = false;           // names sit where SquareNames expects
+
+    // Throws std::runtime_error describing the first problem found.
+    void validate() const;
+
+    // Validates, then derives the tables above. Call again after editing
+    // a definition by hand.
+    void compile();
+
+    bool operator==(const BoardDefinition&) const = default;
+};
+
+// The built-in Watopoly board (validated once, shared).
+export const BoardDefinition& standardBoardDefinition();
+
+// Reads and validates a board file. Throws std::runtime_error with the
+// file name and line number on malformed input.
+export BoardDefinition loadBoardDefinition(const std::string& path);
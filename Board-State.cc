@@ -0,0 +1,39 @@
+// Board-State.cc (interface)
+// Module: BoardState
+// Description:
+//   Everything about a board that changes during one game, in one flat
+//   struct: who owns each square, each academic building's improvement
+//   level, which buildings are mortgaged, and the per-block improvement
+//   counts. The static side (names, prices, rents, blocks) lives in the
+//   shared BoardDefinition, so a game's working set is this struct plus
+//   the players.
+//
+//   Buildings hold a pointer to their board's BoardState and read/write
+//   through it; nothing else about a building changes after construction.
+//
+// Related Modules:
+//   - Board (owns one BoardState per game)
+//   - Building, AcademicBuilding (read and update it)
+//   - Ownership, BlockIndex (the owner table and block counts it contains)
+
+export module BoardState;
+
+import <array>;
+import <cstdint>;
+import <memory_resource>;
+import Ownership;
+import BlockIndex;
+import PropertySet;
+
+export struct BoardState {
+    static constexpr int Squares = 40;
+
+    OwnershipTable ownership;                        // owner per square
+    BlockIndex blocks;                               // improvement count per block
+    std::array<std::uint8_t, Squares> improvements{};  // 0-5 per academic building
+    PropertySet mortgaged;                           // mortgaged buildings
+
+    explicit BoardState(const BlockLayout& layout,
+                        std::pmr::memory_resource* memory = std::pmr::get_default_resource())
+        : ownership{memory}, blocks{layout} {}
+};
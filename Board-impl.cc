@@ -1,9 +1,18 @@
 // Board-impl.cc (implementation)
 // Module: Board
 // Description:
-//   Initializes the 40 Square* instances that make up the Watopoly board.
-//   Squares include ownable (AcademicBuilding, Residence, Gym) and
-//   non-ownable (NEEDLESHALL, SLC, TUITION, DC Tims Line, etc.).
+//   Initializes the 40 Square* instances that make up the Watopoly board
+//   from a BoardDefinition. Squares include ownable (AcademicBuilding,
+//   Residence, Gym) and non-ownable (NEEDLESHALL, SLC, TUITION, DC Tims
+//   Line, etc.); each reads its name, price and rents from the shared
+//   definition, and buildings keep their changing state in this board's
+//   BoardState.
+//
+//   The squares are placed back to back in a single arena allocation
+//   (sized from the definition first), so building or tearing down a board
+//   costs one allocation and the squares sit together in memory. The arena
+//   comes from the board's memory resource: the heap by default, or the
+//   owning Game's monotonic arena.
 //
 //   This class is purely structural — it owns the squares and exposes
 //   access to them. Gameplay control is handled externally (e.g., by GameController).
@@ -12,75 +21,154 @@ module Board;
 
 import <iostream>;
 import <algorithm>;
+import <cstddef>;
+import <memory_resource>;
+import <new>;
+import <utility>;
 import AcademicBuilding;
+import Building;
 import Residence;
 import Gym;
 import ActionSquares;
+import SquareNames;
+import BoardDefinition;
+
+namespace {
+
+// Bump allocator over the board's square arena. Each square is placed at
+// the next offset aligned for its type.
+class SquareArena {
+private:
+    std::byte* base;
+    std::size_t used = 0;
+
+public:
+    explicit SquareArena(std::byte* base) : base{base} {}
+
+    template <typename T>
+    static std::size_t footprint(std::size_t offset) {
+        return (offset + alignof(T) - 1) / alignof(T) * alignof(T) + sizeof(T);
+    }
+
+    template <typename T, typename... Args>
+    T* place(Args&&... args) {
+        std::size_t offset = (used + alignof(T) - 1) / alignof(T) * alignof(T);
+        used = offset + sizeof(T);
+        return new (base + offset) T(std::forward<Args>(args)...);
+    }
+};
 
-Board::Board() {
-    // === Populate all 40 squares in order ===
-
-    squares.push_back(new COLLECTOSAP("COLLECT OSAP", 0));
-    squares.push_back(new AcademicBuilding("AL", 1, 40, "Arts1", 50));
-    squares.push_back(new SLC("SLC", 2));
-    squares.push_back(new AcademicBuilding("ML", 3, 60, "Arts1", 50));
-    squares.push_back(new TUITION("TUITION", 4));
-    squares.push_back(new Residence("MKV", 5, 200));
-    squares.push_back(new AcademicBuilding("ECH", 6, 100, "Arts2", 50));
-    squares.push_back(new NEEDLESHALL("NEEDLES HALL", 7));
-    squares.push_back(new AcademicBuilding("PAS", 8, 100, "Arts2", 50));
-    squares.push_back(new AcademicBuilding("HH", 9, 120, "Arts2", 50));
-    squares.push_back(new DCTimsLine("DC Tims Line", 10));
-    squares.push_back(new AcademicBuilding("RCH", 11, 140, "Eng", 100));
-    squares.push_back(new Gym("PAC", 12, 150));
-    squares.push_back(new AcademicBuilding("DWE", 13, 140, "Eng", 100));
-    squares.push_back(new AcademicBuilding("CPH", 14, 160, "Eng", 100));
-    squares.push_back(new Residence("UWP", 15, 200));
-    squares.push_back(new AcademicBuilding("LHI", 16, 180, "Health", 100));
-    squares.push_back(new SLC("SLC", 17));
-    squares.push_back(new AcademicBuilding("BMH", 18, 180, "Health", 100));
-    squares.push_back(new AcademicBuilding("OPT", 19, 200, "Health", 100));
-    squares.push_back(new GooseNesting("Goose Nesting", 20));
-    squares.push_back(new AcademicBuilding("EV1", 21, 220, "Env", 150));
-    squares.push_back(new NEEDLESHALL("NEEDLES HALL", 22));
-    squares.push_back(new AcademicBuilding("EV2", 23, 220, "Env", 150));
-    squares.push_back(new AcademicBuilding("EV3", 24, 240, "Env", 150));
-    squares.push_back(new Residence("V1", 25, 200));
-    squares.push_back(new AcademicBuilding("PHYS", 26, 260, "Sci1", 150));
-    squares.push_back(new AcademicBuilding("B1", 27, 260, "Sci1", 150));
-    squares.push_back(new Gym("CIF", 28, 150));
-    squares.push_back(new AcademicBuilding("B2", 29, 280, "Sci1", 150));
-    squares.push_back(new GoToTims("GO TO TIMS", 30));
-    squares.push_back(new AcademicBuilding("EIT", 31, 300, "Sci2", 200));
-    squares.push_back(new AcademicBuilding("ESC", 32, 300, "Sci2", 200));
-    squares.push_back(new SLC("SLC", 33));
-    squares.push_back(new AcademicBuilding("C2", 34, 320, "Sci2", 200));
-    squares.push_back(new Residence("REV", 35, 200));
-    squares.push_back(new NEEDLESHALL("NEEDLES HALL", 36));
-    squares.push_back(new AcademicBuilding("MC", 37, 350, "Math", 200));
-    squares.push_back(new CoopFee("COOP FEE", 38));
-    squares.push_back(new AcademicBuilding("DC", 39, 400, "Math", 200));
+// Arena bytes needed for every square of a definition, in board order.
+std::size_t arenaSize(const BoardDefinition& def) {
+    std::size_t size = 0;
+    for (const SquareDefinition& sq : def.squares) {
+        switch (sq.kind) {
+            case SquareKind::CollectOSAP:  size = SquareArena::footprint<COLLECTOSAP>(size); break;
+            case SquareKind::Academic:     size = SquareArena::footprint<AcademicBuilding>(size); break;
+            case SquareKind::Residence:    size = SquareArena::footprint<Residence>(size); break;
+            case SquareKind::Gym:          size = SquareArena::footprint<Gym>(size); break;
+            case SquareKind::SLC:          size = SquareArena::footprint<SLC>(size); break;
+            case SquareKind::Tuition:      size = SquareArena::footprint<TUITION>(size); break;
+            case SquareKind::NeedlesHall:  size = SquareArena::footprint<NEEDLESHALL>(size); break;
+            case SquareKind::DCTimsLine:   size = SquareArena::footprint<DCTimsLine>(size); break;
+            case SquareKind::GooseNesting: size = SquareArena::footprint<GooseNesting>(size); break;
+            case SquareKind::GoToTims:     size = SquareArena::footprint<GoToTims>(size); break;
+            case SquareKind::CoopFee:      size = SquareArena::footprint<CoopFee>(size); break;
+        }
+    }
+    return size;
+}
+
+}  // namespace
+
+Board::Board() : Board{standardBoardDefinition()} {}
+
+Board::Board(const BoardDefinition& definition, std::pmr::memory_resource* memory)
+    : definition{&definition}, memory{memory}, state{definition.blocks, memory} {
+    // === Populate all 40 squares in order, back to back in one arena ===
+    const BoardDefinition& def = definition;
+    arenaBytes = arenaSize(def);
+    arena = static_cast<std::byte*>(memory->allocate(arenaBytes, alignof(std::max_align_t)));
+    SquareArena placer{arena};
+    auto bind = [this](Building* b) {
+        b->setBoardState(&state);
+        return b;
+    };
+
+    // Squares read their static data from the definition; buildings are
+    // bound to this board's state as they are placed.
+    for (int pos = 0; pos < BoardDefinition::Squares; ++pos) {
+        Square*& square = squares[pos];
+        switch (def.squares[pos].kind) {
+            case SquareKind::CollectOSAP:  square = placer.place<COLLECTOSAP>(def, pos); break;
+            case SquareKind::Academic:     square = bind(placer.place<AcademicBuilding>(def, pos)); break;
+            case SquareKind::Residence:    square = bind(placer.place<Residence>(def, pos)); break;
+            case SquareKind::Gym:          square = bind(placer.place<Gym>(def, pos)); break;
+            case SquareKind::SLC:          square = placer.place<SLC>(def, pos); break;
+            case SquareKind::Tuition:      square = placer.place<TUITION>(def, pos); break;
+            case SquareKind::NeedlesHall:  square = placer.place<NEEDLESHALL>(def, pos); break;
+            case SquareKind::DCTimsLine:   square = placer.place<DCTimsLine>(def, pos); break;
+            case SquareKind::GooseNesting: square = placer.place<GooseNesting>(def, pos); break;
+            case SquareKind::GoToTims:     square = placer.place<GoToTims>(def, pos); break;
+            case SquareKind::CoopFee:      square = placer.place<CoopFee>(def, pos); break;
+        }
+    }
 }
 
 Board::~Board() {
     for (auto* square : squares) {
-        delete square;
+        square->~Square();
     }
-    squares.clear();
+    memory->deallocate(arena, arenaBytes, alignof(std::max_align_t));
 }
 
 // Returns the square at a given board position.
 Square* Board::getSquare(int position) const {
-    if (position < 0 || position >= static_cast<int>(squares.size())) return nullptr;
+    if (position < 0 || position >= BoardDefinition::Squares) return nullptr;
     return squares[position];
 }
 
 // Returns a square by its name (e.g., "DC", "EV1").
 Square* Board::getSquareByName(const std::string& name) const {
+    int position = indexOf(name);
+    return position < 0 ? nullptr : squares[position];
+}
+
+int Board::indexOf(std::string_view name) const {
+    if (definition->standardNames) return canonicalSquareIndex(name);
+
     for (auto* square : squares) {
-        if (square->getName() == name) return square;
+        if (square->getName() == name) return square->getPosition();
     }
-    return nullptr;
+    return -1;
+}
+
+const BoardDefinition& Board::getDefinition() const {
+    return *definition;
+}
+
+OwnershipTable& Board::getOwnership() {
+    return state.ownership;
+}
+
+const BlockIndex& Board::getBlocks() const {
+    return state.blocks;
+}
+
+BoardState& Board::getState() {
+    return state;
+}
+
+const BoardState& Board::getState() const {
+    return state;
+}
+
+PropertySet Board::getResidences() const {
+    return definition->residences;
+}
+
+PropertySet Board::getGyms() const {
+    return definition->gyms;
 }
 
 // Optional text display of the board state.
@@ -2,11 +2,17 @@
 // Module: Board
 // Description:
 //   Represents the Watopoly game board containing 40 squares.
-//   This class holds a vector of polymorphic Square* objects,
-//   constructed and ordered according to Watopoly layout.
+//   This class holds 40 polymorphic Square objects in one arena,
+//   constructed and ordered from a BoardDefinition (the built-in
+//   Watopoly layout by default, or a variant loaded from a board file).
 //
-//   Board is purely a data container. It does NOT:
-//     - Know about players
+//   Board is purely a data container. The static layout (names, prices,
+//   rents, blocks, residence/gym masks) is a BoardDefinition shared by
+//   every board built from it; the board itself only owns its squares and
+//   one BoardState: the owner table (the single record of who owns what),
+//   improvement levels, mortgages and per-block improvement counts.
+//   It does NOT:
+//     - Know about players beyond that owner table
 //     - Move players
 //     - Execute game logic
 //
@@ -22,19 +28,41 @@
 
 export module Board;
 
-import <vector>;
+import <array>;
+import <cstddef>;
+import <memory_resource>;
 import <string>;
 import Square;
+import <string_view>;
+import Ownership;
+import PropertySet;
+import BlockIndex;
+import BoardDefinition;
+import BoardState;
 
 export class Board {
 private:
-    std::vector<Square*> squares;  // Ordered list of 40 squares
+    const BoardDefinition* definition;   // Static layout and rules (not owned)
+    std::pmr::memory_resource* memory;   // Where the arena comes from
+    std::byte* arena = nullptr;          // Storage for all 40 squares, contiguous
+    std::size_t arenaBytes = 0;
+    std::array<Square*, BoardDefinition::Squares> squares{};  // Into the arena, by position
+    BoardState state;                    // Everything that changes during the game
 
 public:
-    // Constructs the full board with all 40 square types in order.
+    // Constructs the standard board with all 40 square types in order.
     Board();
 
-    // Destroys all dynamically allocated Square* objects.
+    // Constructs a board variant from a compiled definition. The
+    // definition is referenced, not copied, and must outlive the board.
+    // The square arena and the owner table are allocated from memory.
+    explicit Board(const BoardDefinition& definition,
+                   std::pmr::memory_resource* memory = std::pmr::get_default_resource());
+
+    Board(const Board&) = delete;
+    Board& operator=(const Board&) = delete;
+
+    // Destroys all squares (and returns their arena to its resource).
     ~Board();
 
     // Retrieves the square at the given board index (0–39).
@@ -43,6 +71,27 @@ public:
     // Retrieves a square by its name (e.g., "EV1", "PAC").
     Square* getSquareByName(const std::string& name) const;
 
+    // Position of the first square with this name, or -1. Uses the
+    // compile-time perfect hash for the standard layout, a scan otherwise.
+    int indexOf(std::string_view name) const;
+
+    // The layout and rules this board was built from.
+    const BoardDefinition& getDefinition() const;
+
+    // The owner table shared by every building on this board.
+    OwnershipTable& getOwnership();
+
+    // Monopoly block index (block IDs, members, improvement counts).
+    const BlockIndex& getBlocks() const;
+
+    // This game's mutable board state (owners, improvements, mortgages).
+    BoardState& getState();
+    const BoardState& getState() const;
+
+    // Bitsets of residence / gym positions, for counting with a player's set.
+    PropertySet getResidences() const;
+    PropertySet getGyms() const;
+
     // Optional: Display method (text or X11) for board visualization.
     void display() const;
 };
@@ -2,8 +2,9 @@
 // Module: Building
 // Description:
 //   Implements the base logic for any ownable square on the Watopoly board.
-//   This includes basic data members like name, price, and ownerToken,
-//   as well as onLand(Player*) polymorphic behavior.
+//   Name and price come from the shared BoardDefinition; owner and
+//   mortgage status live in the board's BoardState. Also provides the
+//   onLand(Player*) polymorphic behavior.
 //
 //   Building is an abstract foundation for:
 //     - AcademicBuilding
@@ -17,32 +18,63 @@
 module Building;
 
 import <iostream>;
+import <stdexcept>;
 import LandAction;
 import Player;  // Required to access Player* methods
 
-// Constructor: initializes building with name, position, price.
-// Owner is defaulted to "BANK" (unowned).
-Building::Building(std::string name, int position, int price)
-    : Square{name, position}, price{price}, ownerToken{"BANK"} {}
-
-// Returns the name of the building (inherited from Square).
-std::string Building::getName() const {
-    return name;
-}
+// Constructor: records the building's definition and position.
+// Unowned (Bank) until Board binds it to its state and it is bought.
+Building::Building(const BoardDefinition& layout, int position)
+    : Square{layout, position} {}
 
 // Returns the price to purchase this building.
 int Building::getPrice() const {
-    return price;
+    return definition().price;
+}
+
+void Building::setBoardState(BoardState* boardState) {
+    state = boardState;
+}
+
+// Returns the owning player, or nullptr for the Bank.
+Player* Building::getOwner() const {
+    return state ? state->ownership.ownerOf(position) : nullptr;
+}
+
+// The one place a building changes hands. The owner table updates the
+// players' property bitsets; this moves the asset totals alongside.
+void Building::setOwner(Player* p) {
+    if (!state) {
+        throw std::logic_error("Building " + getName() + " is not on a board");
+    }
+
+    Player* old = state->ownership.ownerOf(position);
+    if (old == p) return;
+
+    const int price = getPrice();
+    int liability = isMortgaged() ? getUnmortgageCost() : 0;
+    if (old) old->adjustAssets(-price, -getImprovementValue(), -liability);
+    state->ownership.setOwner(position, p);
+    if (p) p->adjustAssets(price, getImprovementValue(), liability);
 }
 
 // Returns the owner token string ("BANK" if unowned).
 std::string Building::getOwnerToken() const {
-    return ownerToken;
+    Player* owner = getOwner();
+    return owner ? owner->getToken() : "BANK";
 }
 
-// Updates the building's owner token (used by GameController).
+// Resolves a token to a registered player ("BANK"/"" mean the Bank).
 void Building::setOwnerToken(const std::string& token) {
-    ownerToken = token;
+    setOwner(state ? state->ownership.findPlayer(token) : nullptr);
+}
+
+int Building::getImprovementValue() const {
+    return 0;
+}
+
+int Building::getUnmortgageCost() const {
+    return (getPrice() / 2) * 1.1;
 }
 
 // Triggered when a player lands on this square.
@@ -51,11 +83,12 @@ LandAction Building::onLand(Player* p) {
     std::cout << p->getName() << " landed on " << getName() << " at position "
               << getPosition() << ".\n";
 
-    if (ownerToken == "BANK") {
-        std::cout << "This property is unowned. You may buy it for $" << price << ".\n";
+    Player* owner = getOwner();
+    if (!owner) {
+        std::cout << "This property is unowned. You may buy it for $" << getPrice() << ".\n";
         return LandAction::PromptPurchase;
-    } else if (ownerToken != p->getToken()) {
-        std::cout << "This property is owned by " << ownerToken << ". Rent logic goes here.\n";
+    } else if (owner != p) {
+        std::cout << "This property is owned by " << owner->getToken() << ". Rent logic goes here.\n";
         return LandAction::PayRent;
     } else {
         std::cout << "You own this property.\n";
@@ -64,10 +97,20 @@ LandAction Building::onLand(Player* p) {
 }
 
 bool Building::isMortgaged() const {
-    return mortgaged;
+    return state && state->mortgaged.contains(position);
 }
 
-void Building::setMortgaged(bool state) {
-    mortgaged = state;
+// Keeps the owner's mortgage liability in step with the flag.
+void Building::setMortgaged(bool mortgaged) {
+    if (mortgaged == isMortgaged()) return;
+    if (!state) {
+        throw std::logic_error("Building " + getName() + " is not on a board");
+    }
+
+    if (mortgaged) state->mortgaged.insert(position);
+    else state->mortgaged.erase(position);
+    if (Player* owner = getOwner()) {
+        owner->adjustAssets(0, 0, mortgaged ? getUnmortgageCost() : -getUnmortgageCost());
+    }
 }
 
@@ -7,7 +7,12 @@
 //
 //   All Buildings:
 //     - Are derived from Square
-//     - Store an ownerToken (not a Player* to avoid circular dependency)
+//     - Read their price from the shared BoardDefinition
+//     - Read and change their owner and mortgage status through the
+//       board's BoardState (the single source of truth; no copy is
+//       stored here)
+//     - Keep the owner's running asset totals in step whenever ownership,
+//       improvements or mortgage status change
 //     - Support polymorphic behavior via onLand(Player*)
 //
 //   Ownership, pricing, and interaction logic are designed to work in
@@ -25,29 +30,42 @@ import <string>;
 import LandAction;
 import Player;   // Used in onLand(Player*)
 import Square;   // Building is-a Square
+import BoardDefinition;
+import BoardState;
 
 export class Building : public Square {
-private:
-    int price;                  // Purchase price of the property
-    std::string ownerToken;     // Player token representing current owner ("BANK" if unowned)
-    bool mortgaged = false;  // NEW: track mortgage status
+protected:
+    BoardState* state = nullptr;  // Board's per-game state (set by Board)
 
 public:
-    // Constructs a building with name, board position, and price.
-    Building(std::string name, int position, int price);  
-
-    // Returns the name of the building (inherited from Square).
-    std::string getName() const;
+    // Constructs the building at a position of a board definition.
+    Building(const BoardDefinition& layout, int position);
 
     // Returns the price required to purchase this property.
     int getPrice() const;
 
-    // Returns the player token of the current owner.
+    // Binds this building to its board's per-game state.
+    void setBoardState(BoardState* boardState);
+
+    // Returns the current owner, or nullptr if the Bank owns it.
+    Player* getOwner() const;
+
+    // Changes the owner (nullptr = Bank) and moves this building's value
+    // between the old and new owner's asset totals.
+    void setOwner(Player* p);
+
+    // Returns the player token of the current owner ("BANK" if unowned).
     std::string getOwnerToken() const;
 
-    // Sets the owner token of this building.
+    // Sets the owner by token ("BANK" or "" for the Bank).
     void setOwnerToken(const std::string& token);
 
+    // Value of improvements on this building (0 unless academic).
+    virtual int getImprovementValue() const;
+
+    // Half the price plus 10% interest: what lifting the mortgage costs.
+    int getUnmortgageCost() const;
+
     // Called when a player lands on this square.
     // Will describe possible actions: buy, pay rent, or do nothing.
     LandAction onLand(Player* p) override;
@@ -0,0 +1,402 @@
+// Endgame-Solver-impl.cc (implementation)
+// Module: EndgameSolver
+// Description:
+//   The search itself. Every node is a Game forked from its parent, so a
+//   branch can be played with the real controller and thrown away; a
+//   Search holds what all threads share (the table, the deadline and the
+//   counters) and the two seats being searched. A turn is played one
+//   stepTurn at a time, and each step that would draw from the RNG is
+//   played once per outcome instead, on its own fork, with the outcome
+//   given through setNextDice or setNextDraw.
+
+module EndgameSolver;
+
+import <algorithm>;
+import <array>;
+import <atomic>;
+import <bit>;
+import <chrono>;
+import <cstdint>;
+import <iostream>;
+import <memory>;
+import <stdexcept>;
+import <thread>;
+import <utility>;
+import AcademicBuilding;
+import BoardDefinition;
+import Building;
+import GameController;
+import Strategy;
+
+namespace {
+
+using Clock = std::chrono::steady_clock;
+
+// The 21 distinct rolls and their weight out of 36.
+struct DiceRoll {
+    int die1;
+    int die2;
+    double weight;
+};
+
+constexpr std::array<DiceRoll, 21> diceRolls = [] {
+    std::array<DiceRoll, 21> rolls{};
+    int i = 0;
+    for (int d1 = 1; d1 <= 6; ++d1) {
+        for (int d2 = d1; d2 <= 6; ++d2) rolls[i++] = {d1, d2, (d1 == d2 ? 1.0 : 2.0) / 36};
+    }
+    return rolls;
+}();
+
+// What the next stepTurn of a turn draws from the RNG.
+enum class Draw { None, Dice, Slc, NeedlesHall };
+
+Draw nextDraw(const Game& game) {
+    const TurnState& turn = game.getController().getTurnState();
+    switch (turn.phase) {
+        case TurnPhase::Jail:
+        case TurnPhase::Roll:
+            return turn.nextDice ? Draw::None : Draw::Dice;
+        case TurnPhase::Resolve:
+            switch (game.getBoard().getDefinition().squares[turn.player->getPosition()].kind) {
+                case SquareKind::SLC:         return Draw::Slc;
+                case SquareKind::NeedlesHall: return Draw::NeedlesHall;
+                default:                      return Draw::None;
+            }
+        default:
+            return Draw::None;
+    }
+}
+
+// Makes outcome i of table the next draw; returns its probability.
+template <typename Outcome>
+double forceDraw(GameController& controller, const ChanceTable<Outcome>& table, int i) {
+    int slot = 0;
+    for (int j = 0; j < i; ++j) slot += table.weight(j);
+    controller.setNextDraw(slot);
+    return static_cast<double>(table.weight(i)) / table.totalWeight();
+}
+
+// splitmix64's finaliser.
+std::uint64_t scramble(std::uint64_t x) {
+    x ^= x >> 30;
+    x *= 0xbf58476d1ce4e5b9ull;
+    x ^= x >> 27;
+    x *= 0x94d049bb133111ebull;
+    return x ^ (x >> 31);
+}
+
+// Lock-free: a slot stores key ^ data next to data, and a probe only
+// trusts data whose xor with the other word gives back its key, so two
+// threads writing one slot at once at worst lose an entry.
+class TranspositionTable {
+public:
+    explicit TranspositionTable(int bits)
+        : slots(std::size_t{1} << std::clamp(bits, 4, 28)), mask{slots.size() - 1} {}
+
+    bool probe(std::uint64_t key, double& value) const {
+        const Slot& slot = slots[key & mask];
+        const std::uint64_t data = slot.data.load(std::memory_order_relaxed);
+        if ((slot.check.load(std::memory_order_relaxed) ^ data) != key) return false;
+        value = std::bit_cast<double>(data);
+        return true;
+    }
+
+    void store(std::uint64_t key, double value) {
+        Slot& slot = slots[key & mask];
+        const std::uint64_t data = std::bit_cast<std::uint64_t>(value);
+        slot.check.store(key ^ data, std::memory_order_relaxed);
+        slot.data.store(data, std::memory_order_relaxed);
+    }
+
+private:
+    struct Slot {
+        std::atomic<std::uint64_t> check{0};
+        std::atomic<std::uint64_t> data{0};
+    };
+    std::vector<Slot> slots;
+    std::size_t mask;
+};
+
+struct Candidate {
+    EndgameMove move;
+    std::unique_ptr<Game> position;  // after the move
+};
+
+class Search {
+public:
+    Search(std::array<int, 2> seats, TranspositionTable& table, Clock::time_point deadline)
+        : seats{seats}, table{table}, deadline{deadline} {}
+
+    // The root player's share of the two net worths.
+    double leafScore(const Game& game) const {
+        const double mine = std::max(0, game.getPlayer(seats[0])->getNetWorth());
+        const double theirs = std::max(0, game.getPlayer(seats[1])->getNetWorth());
+        return mine + theirs > 0 ? mine / (mine + theirs) : 0.5;
+    }
+
+    // Every management move the player in seat `side` can make, each
+    // applied to its own fork; "roll" (no move) comes first.
+    std::vector<Candidate> candidates(const Game& game, int side) const {
+        std::vector<Candidate> moves;
+        moves.push_back({EndgameMove{}, game.fork()});
+        const Player* p = game.getPlayer(seats[side]);
+        const Board& board = game.getBoard();
+        for (int pos : p->getProperties()) {
+            auto* b = dynamic_cast<Building*>(board.getSquare(pos));
+            if (!b) continue;
+            const bool academic = dynamic_cast<AcademicBuilding*>(b) != nullptr;
+            for (EndgameMoveKind kind : {EndgameMoveKind::Improve, EndgameMoveKind::Degrade,
+                                         EndgameMoveKind::Mortgage, EndgameMoveKind::Unmortgage}) {
+                const bool improvement = kind == EndgameMoveKind::Improve || kind == EndgameMoveKind::Degrade;
+                if (improvement && !academic) continue;
+                if ((kind == EndgameMoveKind::Unmortgage) != b->isMortgaged()) continue;
+                EndgameMove move{kind, b->getName()};
+                std::unique_ptr<Game> child = game.fork();
+                if (apply(*child, side, move)) moves.push_back({std::move(move), std::move(child)});
+            }
+        }
+        return moves;
+    }
+
+    // A turn whose first roll is `roll`, on a fork of `game` (which is
+    // after the mover's management move).
+    double afterRoll(const Game& game, int side, int depth, const DiceRoll& roll) {
+        std::unique_ptr<Game> next = game.fork();
+        GameController& controller = next->getController();
+        controller.beginTurn(next->getPlayer(seats[side]));
+        controller.setNextDice(std::pair{roll.die1, roll.die2});
+        return playOut(std::move(next), side, depth);
+    }
+
+    // Plays the turn in progress on `game` up to its next draw, which is a
+    // chance node over the dice, the SLC cards or the Needles Hall amounts;
+    // once the turn is over, the other player's decision node.
+    double playOut(std::unique_ptr<Game> game, int side, int depth) {
+        GameController& controller = game->getController();
+        Draw draw;
+        while ((draw = nextDraw(*game)) == Draw::None) {
+            if (controller.getTurnState().phase == TurnPhase::Done) return decide(*game, 1 - side, depth - 1);
+            controller.stepTurn();
+        }
+        if (expired()) return leafScore(*game);
+        nodes.fetch_add(1, std::memory_order_relaxed);
+
+        const std::uint64_t key = chanceKey(*game, side, depth);
+        double value;
+        if (table.probe(key, value)) {
+            tableHits.fetch_add(1, std::memory_order_relaxed);
+            return value;
+        }
+
+        const BoardDefinition& definition = game->getBoard().getDefinition();
+        const int outcomes = draw == Draw::Dice ? static_cast<int>(diceRolls.size())
+                             : draw == Draw::Slc ? definition.slc.size()
+                                                 : definition.needlesHall.size();
+        value = 0;
+        for (int i = 0; i < outcomes; ++i) {
+            // The last outcome is played on `game` itself.
+            std::unique_ptr<Game> next = i + 1 < outcomes ? game->fork() : std::move(game);
+            GameController& stepper = next->getController();
+            double weight = 0;
+            switch (draw) {
+                case Draw::Dice:
+                    stepper.setNextDice(std::pair{diceRolls[i].die1, diceRolls[i].die2});
+                    weight = diceRolls[i].weight;
+                    break;
+                case Draw::Slc:
+                    weight = forceDraw(stepper, definition.slc, i);
+                    break;
+                default:
+                    weight = forceDraw(stepper, definition.needlesHall, i);
+            }
+            stepper.stepTurn();
+            // Out of the Tims line with a cup or the fine: nothing was drawn.
+            if (stepper.getTurnState().nextDice || stepper.getTurnState().nextDraw) {
+                stepper.setNextDice(std::nullopt);
+                stepper.setNextDraw(std::nullopt);
+                value = playOut(std::move(next), side, depth);
+                break;
+            }
+            value += weight * playOut(std::move(next), side, depth);
+        }
+        if (!stopped()) table.store(key, value);
+        return value;
+    }
+
+    // The player in seat `side` is about to move, `depth` turns are left.
+    double decide(const Game& game, int side, int depth) {
+        if (game.getPlayer(seats[0])->isBankrupt()) return 0;
+        if (game.getPlayer(seats[1])->isBankrupt()) return 1;
+        if (depth == 0 || expired()) return leafScore(game);
+        nodes.fetch_add(1, std::memory_order_relaxed);
+
+        const std::uint64_t key = keyOf(game, side, depth);
+        double value;
+        if (table.probe(key, value)) {
+            tableHits.fetch_add(1, std::memory_order_relaxed);
+            return value;
+        }
+
+        value = side == 0 ? 0.0 : 1.0;
+        for (const Candidate& c : candidates(game, side)) {
+            double expected = 0;
+            for (const DiceRoll& roll : diceRolls) expected += roll.weight * afterRoll(*c.position, side, depth, roll);
+            value = side == 0 ? std::max(value, expected) : std::min(value, expected);
+        }
+        // A value built from cut-off branches is not the depth's value.
+        if (!stopped()) table.store(key, value);
+        return value;
+    }
+
+    bool expired() {
+        if (stopped()) return true;
+        if (Clock::now() < deadline) return false;
+        stop.store(true, std::memory_order_relaxed);
+        return true;
+    }
+
+    bool stopped() const {
+        return stop.load(std::memory_order_relaxed);
+    }
+
+    long long nodeCount() const { return nodes.load(); }
+    long long hitCount() const { return tableHits.load(); }
+
+private:
+    std::array<int, 2> seats;  // root player, opponent (turn-order indices)
+    TranspositionTable& table;
+    Clock::time_point deadline;
+    std::atomic<bool> stop{false};
+    std::atomic<long long> nodes{0};
+    std::atomic<long long> tableHits{0};
+
+    bool apply(Game& game, int side, const EndgameMove& move) const {
+        GameController& controller = game.getController();
+        Player* p = game.getPlayer(seats[side]);
+        Building* b = controller.getBuilding(move.building);
+        switch (move.kind) {
+            case EndgameMoveKind::Improve:
+                return controller.improveBuilding(p, dynamic_cast<AcademicBuilding*>(b));
+            case EndgameMoveKind::Degrade:
+                return controller.degradeBuilding(p, dynamic_cast<AcademicBuilding*>(b));
+            case EndgameMoveKind::Mortgage:
+                return controller.mortgageBuilding(p, b);
+            case EndgameMoveKind::Unmortgage:
+                return controller.unmortgageBuilding(p, b);
+            default:
+                return true;
+        }
+    }
+
+    static std::uint64_t keyOf(const Game& game, int side, int depth) {
+        const std::uint64_t key =
+            scramble(game.getController().stateHash() ^ (static_cast<std::uint64_t>(depth) << 1 | side));
+        return key ? key : 1;  // an empty slot reads as key 0
+    }
+
+    // A mid-turn node also depends on where the turn is; the phase is
+    // never zero here, so these keys differ from keyOf's.
+    static std::uint64_t chanceKey(const Game& game, int side, int depth) {
+        const TurnState& turn = game.getController().getTurnState();
+        const std::uint64_t inTurn = (static_cast<std::uint64_t>(turn.phase) + 1) | turn.die1 << 4 |
+                                     turn.die2 << 8 | turn.doublesStreak << 12 | turn.extraTurnAllowed << 16;
+        const std::uint64_t key = scramble(game.getController().stateHash() ^
+                                           (static_cast<std::uint64_t>(depth) << 1 | side) ^ inTurn << 40);
+        return key ? key : 1;
+    }
+};
+
+}  // namespace
+
+EndgameResult solveEndgame(const Game& game, const Player* toMove, const EndgameConfig& config) {
+    std::array<int, 2> seats{-1, -1};
+    int active = 0;
+    for (int i = 0; i < game.playerCount(); ++i) {
+        const Player* p = game.getPlayer(i);
+        if (p->isBankrupt()) continue;
+        ++active;
+        if (p == toMove) {
+            seats[0] = i;
+        } else {
+            seats[1] = i;
+        }
+    }
+    if (active != 2 || seats[0] < 0) {
+        throw std::invalid_argument("the endgame solver needs exactly two players left, one of them to move");
+    }
+
+    // Bots decide inside the turns; a human seat plays as always-buy.
+    std::unique_ptr<Game> root = game.fork();
+    GameController& controller = root->getController();
+    for (int seat : seats) {
+        const Player* p = root->getPlayer(seat);
+        if (!controller.getStrategy(p)) controller.setStrategy(p, findStrategy("always-buy"));
+    }
+    controller.setAuctionMode(AuctionMode::ProxyEnglish);
+
+    const Clock::time_point deadline =
+        config.seconds > 0 ? Clock::now() + std::chrono::duration_cast<Clock::duration>(
+                                                std::chrono::duration<double>(config.seconds))
+                           : Clock::time_point::max();
+    TranspositionTable table{config.tableBits};
+    Search search{seats, table, deadline};
+
+    EndgameResult result;
+    result.winProbability = search.leafScore(*root);
+
+    // The searches' console output goes nowhere while they run.
+    std::ios_base::iostate coutState = std::cout.rdstate();
+    std::cout.setstate(std::ios::failbit);
+
+    const std::vector<Candidate> moves = search.candidates(*root, 0);
+    const std::size_t items = moves.size() * diceRolls.size();
+    unsigned threads = config.threads ? config.threads : std::thread::hardware_concurrency();
+    threads = static_cast<unsigned>(std::max<std::size_t>(1, std::min<std::size_t>(threads, items)));
+
+    for (int depth = 1; depth <= config.depth; ++depth) {
+        // Item i is roll i % 21 after move i / 21.
+        std::vector<double> values(items);
+        std::atomic<std::size_t> next{0};
+        auto worker = [&] {
+            for (std::size_t i; (i = next.fetch_add(1, std::memory_order_relaxed)) < items && !search.stopped();) {
+                const DiceRoll& roll = diceRolls[i % diceRolls.size()];
+                values[i] = roll.weight * search.afterRoll(*moves[i / diceRolls.size()].position, 0, depth, roll);
+            }
+        };
+        std::vector<std::thread> pool;
+        for (unsigned t = 1; t < threads; ++t) pool.emplace_back(worker);
+        worker();
+        for (auto& t : pool) t.join();
+        if (search.stopped()) break;
+
+        result.moves.clear();
+        for (std::size_t m = 0; m < moves.size(); ++m) {
+            double expected = 0;
+            for (std::size_t r = 0; r < diceRolls.size(); ++r) expected += values[m * diceRolls.size() + r];
+            result.moves.emplace_back(moves[m].move, expected);
+        }
+        std::stable_sort(result.moves.begin(), result.moves.end(),
+                         [](const auto& a, const auto& b) { return a.second > b.second; });
+        result.best = result.moves.front().first;
+        result.winProbability = result.moves.front().second;
+        result.depth = depth;
+    }
+    std::cout.clear(coutState);
+
+    result.opponentWinProbability = 1 - result.winProbability;
+    result.complete = result.depth == config.depth;
+    result.nodes = search.nodeCount();
+    result.tableHits = search.hitCount();
+    return result;
+}
+
+std::string describe(const EndgameMove& move) {
+    switch (move.kind) {
+        case EndgameMoveKind::Improve:    return "improve " + move.building;
+        case EndgameMoveKind::Degrade:    return "sell an improvement on " + move.building;
+        case EndgameMoveKind::Mortgage:   return "mortgage " + move.building;
+        case EndgameMoveKind::Unmortgage: return "unmortgage " + move.building;
+        default:                          return "roll";
+    }
+}
@@ -0,0 +1,96 @@
+// Endgame-Solver.cc (interface)
+// Module: EndgameSolver
+// Description:
+//   Searches two-player positions for the player about to roll: what to
+//   improve, sell, mortgage or unmortgage first, and each player's chance
+//   of winning.
+//
+//   The search is expectimax over turns. Before each turn the player to
+//   move picks one management move (or none) from what
+//   GameController::improveBuilding, degradeBuilding, mortgageBuilding and
+//   unmortgageBuilding accept in that position; the root player maximises
+//   their win probability and the opponent minimises it. The turn itself
+//   is played phase by phase (GameController::stepTurn) on forks of the
+//   game, and every random draw in it is a chance node over all of its
+//   outcomes: the 21 distinct rolls, weighted 1/36 or 2/36, for the first
+//   roll, each doubles re-roll and each roll for doubles in the Tims line,
+//   and the SLC and Needles Hall tables with their weights, each outcome
+//   given to its fork with setNextDice or setNextDraw. The value is the
+//   exact expectation over the turn; nothing is sampled. Decisions inside
+//   the turn (purchases, bids, the Tims line, Tuition, raising funds) come
+//   from each player's Strategy, and always-buy's for human players. A
+//   bankruptcy ends the search with a win or a loss; at the depth limit a
+//   position is scored by the root player's share of the two net worths.
+//   A turn has a few thousand outcomes, so each turn of depth costs about
+//   that factor more.
+//
+//   Search runs by iterative deepening until `depth` turns or the time
+//   budget, whichever comes first; the result is that of the deepest
+//   search that finished. Only the root is parallel: its (move, first
+//   roll) pairs are shared out to worker threads, and everything below a
+//   pair, the deeper chance nodes included, runs on the thread that took
+//   it. Every thread reads and writes one transposition table: a fixed
+//   array of two-word slots keyed by stateHash, the player to move and
+//   the depth left (and, inside a turn, where the turn is), written
+//   without locks (a slot holds key ^ data and data, so a torn write just
+//   fails its check). Only values of the same depth are reused, so the
+//   probabilities and moves do not depend on the number of threads.
+//
+// Related Modules:
+//   - Game (fork), GameController (the moves, stepTurn, setNextDice,
+//     setNextDraw, stateHash)
+//   - Strategy (in-turn decisions)
+
+export module EndgameSolver;
+
+import <string>;
+import <vector>;
+import Game;
+import Player;
+
+export enum class EndgameMoveKind {
+    None,        // just roll
+    Improve,     // improveBuilding
+    Degrade,     // degradeBuilding (sell an improvement)
+    Mortgage,    // mortgageBuilding
+    Unmortgage   // unmortgageBuilding
+};
+
+export struct EndgameMove {
+    EndgameMoveKind kind = EndgameMoveKind::None;
+    std::string building;  // empty for None
+
+    bool operator==(const EndgameMove&) const = default;
+};
+
+export struct EndgameConfig {
+    int depth = 3;           // turns to search (each player's turn counts one)
+    double seconds = 1.0;    // wall-clock budget; 0 = no limit
+    unsigned threads = 0;    // 0 = hardware concurrency
+    int tableBits = 20;      // 2^tableBits transposition table slots
+};
+
+export struct EndgameResult {
+    double winProbability = 0;        // of the player to move
+    double opponentWinProbability = 0;
+    EndgameMove best;
+    // Every legal root move with its win probability, best first. Empty if
+    // not even one turn could be searched in time; the probabilities are
+    // then the root's net worth share.
+    std::vector<std::pair<EndgameMove, double>> moves;
+    int depth = 0;                    // turns searched by the result
+    bool complete = false;            // reached config.depth within the budget
+    // Decision and chance nodes searched (all depths) and table hits.
+    // These vary with thread timing: two threads can both miss a node
+    // before either stores it.
+    long long nodes = 0;
+    long long tableHits = 0;
+};
+
+// Solves the position for toMove, who is about to start their turn.
+// Changes nothing in game. Throws std::invalid_argument unless exactly two
+// players are left and toMove is one of them.
+export EndgameResult solveEndgame(const Game& game, const Player* toMove, const EndgameConfig& config = {});
+
+// "improve DC", "mortgage MKV", "roll", ...
+export std::string describe(const EndgameMove& move);
@@ -0,0 +1,105 @@
+// Game-Analytics-impl.cc (implementation)
+// Module: GameAnalytics
+// Description:
+//   Merging of per-thread counter blocks and the CSV export.
+
+module GameAnalytics;
+
+import <algorithm>;
+import <string>;
+
+namespace {
+
+const char* kindName(SquareKind kind) {
+    switch (kind) {
+        case SquareKind::CollectOSAP:  return "osap";
+        case SquareKind::Academic:     return "academic";
+        case SquareKind::Residence:    return "residence";
+        case SquareKind::Gym:          return "gym";
+        case SquareKind::SLC:          return "slc";
+        case SquareKind::Tuition:      return "tuition";
+        case SquareKind::NeedlesHall:  return "needles";
+        case SquareKind::DCTimsLine:   return "tims";
+        case SquareKind::GooseNesting: return "goose";
+        case SquareKind::GoToTims:     return "gototims";
+        case SquareKind::CoopFee:      return "coop";
+    }
+    return "?";
+}
+
+// CSV field: quoted only when it contains a separator or a quote.
+void writeField(std::ostream& out, const std::string& text) {
+    if (text.find_first_of(",\"\n") == std::string::npos) {
+        out << text;
+        return;
+    }
+    out << '"';
+    for (char c : text) {
+        if (c == '"') out << '"';
+        out << c;
+    }
+    out << '"';
+}
+
+}  // namespace
+
+void AnalyticsBlock::merge(const AnalyticsBlock& other) {
+    for (int i = 0; i < BoardDefinition::Squares; ++i) {
+        SquareCounters& to = squares[i];
+        const SquareCounters& from = other.squares[i];
+        to.landings += from.landings;
+        to.rentPayments += from.rentPayments;
+        to.rentCollected += from.rentCollected;
+        to.purchases += from.purchases;
+        to.auctions += from.auctions;
+        to.auctionTotal += from.auctionTotal;
+        to.auctionMax = std::max(to.auctionMax, from.auctionMax);
+        to.mortgages += from.mortgages;
+        to.bankruptcies += from.bankruptcies;
+    }
+    turns += other.turns;
+}
+
+AnalyticsBatch::AnalyticsBatch(int threads) : blocks(threads) {}
+
+AnalyticsBlock& AnalyticsBatch::block(int thread) {
+    return blocks[thread];
+}
+
+int AnalyticsBatch::threads() const {
+    return static_cast<int>(blocks.size());
+}
+
+AnalyticsBlock AnalyticsBatch::merge() const {
+    AnalyticsBlock total;
+    for (const AnalyticsBlock& b : blocks) total.merge(b);
+    return total;
+}
+
+void writeAnalyticsCsv(std::ostream& out, const AnalyticsBlock& counts,
+                       const BoardDefinition& definition) {
+    out << "position,name,kind,landings,landing_share,rent_payments,rent_collected,"
+           "purchases,auctions,auction_total,auction_mean,auction_max,mortgages,bankruptcies\n";
+
+    std::uint64_t totalLandings = 0;
+    for (const SquareCounters& c : counts.squares) totalLandings += c.landings;
+
+    for (int pos = 0; pos < BoardDefinition::Squares; ++pos) {
+        const SquareCounters& c = counts.squares[pos];
+        const SquareDefinition& sq = definition.squares[pos];
+        out << pos << ",";
+        writeField(out, sq.name);
+        out << "," << kindName(sq.kind)
+            << "," << c.landings
+            << "," << (totalLandings ? static_cast<double>(c.landings) / totalLandings : 0.0)
+            << "," << c.rentPayments
+            << "," << c.rentCollected
+            << "," << c.purchases
+            << "," << c.auctions
+            << "," << c.auctionTotal
+            << "," << (c.auctions ? static_cast<double>(c.auctionTotal) / c.auctions : 0.0)
+            << "," << c.auctionMax
+            << "," << c.mortgages
+            << "," << c.bankruptcies << "\n";
+    }
+}
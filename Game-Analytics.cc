@@ -0,0 +1,68 @@
+// Game-Analytics.cc (interface)
+// Module: GameAnalytics
+// Description:
+//   Per-square game counters for batch simulations, collected directly
+//   from GameController's resolution paths instead of parsed out of the
+//   console text: landings, rent collected, purchases, auctions and their
+//   clearing prices, mortgages, and the squares where bankruptcies were
+//   triggered.
+//
+//   Counters live in AnalyticsBlocks. A block is plain integers, aligned
+//   to its own cache lines, and written by exactly one thread: each worker
+//   in a batch attaches its block (AnalyticsBatch::block(thread)) to the
+//   controllers of the games it runs, so counting is an unsynchronised
+//   increment with no false sharing between workers. merge() sums the
+//   blocks once the batch is done, and writeAnalyticsCsv() exports the
+//   result, one row per square.
+//
+// Related Modules:
+//   - GameController (feeds an attached block; see setAnalytics())
+//   - BoardDefinition (square names and kinds for the CSV)
+
+export module GameAnalytics;
+
+import <array>;
+import <cstdint>;
+import <ostream>;
+import <vector>;
+import BoardDefinition;
+
+export struct SquareCounters {
+    std::uint64_t landings = 0;        // turns that ended a move here (before any SLC jump)
+    std::uint64_t rentPayments = 0;    // rents paid in full to this property's owner
+    std::uint64_t rentCollected = 0;   // dollars
+    std::uint64_t purchases = 0;       // bought from the Bank at list price
+    std::uint64_t auctions = 0;        // sold at auction
+    std::uint64_t auctionTotal = 0;    // sum of clearing prices
+    std::uint64_t auctionMax = 0;      // highest clearing price
+    std::uint64_t mortgages = 0;
+    std::uint64_t bankruptcies = 0;    // bankruptcies declared while standing here
+};
+
+export struct alignas(64) AnalyticsBlock {
+    std::array<SquareCounters, BoardDefinition::Squares> squares{};
+    std::uint64_t turns = 0;
+
+    // Adds other's counts into this block.
+    void merge(const AnalyticsBlock& other);
+};
+
+// One block per worker thread of a batch.
+export class AnalyticsBatch {
+public:
+    explicit AnalyticsBatch(int threads);
+
+    // The block owned by one worker. Only that worker may write it.
+    AnalyticsBlock& block(int thread);
+    int threads() const;
+
+    // Sum over every worker (call once the workers are finished).
+    AnalyticsBlock merge() const;
+
+private:
+    std::vector<AnalyticsBlock> blocks;
+};
+
+// Writes a header line and one row per square.
+export void writeAnalyticsCsv(std::ostream& out, const AnalyticsBlock& counts,
+                              const BoardDefinition& definition);
@@ -15,17 +15,50 @@ import <random>;
 import <ctime>;
 import <algorithm>;  // For std::all_of
 import <cctype>;     // For ::isdigit
+import <cstdint>;
 import LandAction;
 import Square;
+import ActionSquares;
+import PropertySet;
+import BoardState;
+import Trace;
+
+namespace {
+
+const char* phaseTraceName(TurnPhase phase) {
+    switch (phase) {
+        case TurnPhase::Jail:      return "jail";
+        case TurnPhase::Roll:      return "roll";
+        case TurnPhase::Move:      return "move";
+        case TurnPhase::Resolve:   return "resolve";
+        case TurnPhase::ExtraTurn: return "extra turn";
+        case TurnPhase::Done:      break;
+    }
+    return "done";
+}
+
+}  // namespace
+
+GameController::GameController(std::pmr::memory_resource* memory)
+    : players{memory}, buildings{memory}, traceGame{Tracer::newGameId()},
+      strategies{memory}, auctionBidders{memory}, auctionMaxima{memory}, auctionActive{memory} {
+    if (ScenarioLog::path()) scenarioLog = std::make_unique<ScenarioLog>();
+}
+
+GameController::~GameController() {
+    if (scenarioLog) scenarioLog->append();
+}
 
 // Registers a Player with the controller using their token as the key.
+// Also makes the player resolvable by token in the board's owner table.
 void GameController::addPlayer(Player* p) {
-    players[p->getToken()] = p;
+    players.insert_or_assign(std::pmr::string{p->getToken(), players.get_allocator()}, p);
+    if (board) board->getOwnership().addPlayer(p);
 }
 
 // Registers a Building with the controller using its name as the key.
 void GameController::addBuilding(Building* b) {
-    buildings[b->getName()] = b;
+    buildings.insert_or_assign(std::pmr::string{b->getName(), buildings.get_allocator()}, b);
 }
 
 // Retrieves a Player pointer by token.
@@ -36,8 +69,13 @@ Player* GameController::getPlayer(const std::string& token) const {
 }
 
 // Retrieves a Building pointer by name.
-// Returns nullptr if the building does not exist.
+// Returns nullptr if the building does not exist. Board squares resolve
+// through Board::indexOf; the map only holds extra addBuilding() entries.
 Building* GameController::getBuilding(const std::string& name) const {
+    if (board) {
+        int position = board->indexOf(name);
+        if (position >= 0 && buildingAt[position]) return buildingAt[position];
+    }
     auto it = buildings.find(name);
     return (it != buildings.end()) ? it->second : nullptr;
 }
@@ -78,13 +116,9 @@ void GameController::trade(const std::string& fromToken, const std::string& give
         }
 
         if (auto* ab = dynamic_cast<AcademicBuilding*>(giveBuilding)) {
-            std::string block = ab->getMonopolyBlock();
-            for (const auto& [_, bldg] : buildings) {
-                auto* other = dynamic_cast<AcademicBuilding*>(bldg);
-                if (other && other->getMonopolyBlock() == block && other->getImprovementCount() > 0) {
-                    std::cout << "[Error] Cannot trade \"" << giveStr << "\" because it or another property in its monopoly has improvements.\n";
-                    return;
-                }
+            if (board->getBlocks().improvements(ab->getBlockId()) > 0) {
+                std::cout << "[Error] Cannot trade \"" << giveStr << "\" because it or another property in its monopoly has improvements.\n";
+                return;
             }
         }
     }
@@ -97,13 +131,9 @@ void GameController::trade(const std::string& fromToken, const std::string& give
         }
 
         if (auto* ab = dynamic_cast<AcademicBuilding*>(receiveBuilding)) {
-            std::string block = ab->getMonopolyBlock();
-            for (const auto& [_, bldg] : buildings) {
-                auto* other = dynamic_cast<AcademicBuilding*>(bldg);
-                if (other && other->getMonopolyBlock() == block && other->getImprovementCount() > 0) {
-                    std::cout << "[Error] Cannot receive \"" << receiveStr << "\" because it or another property in its monopoly has improvements.\n";
-                    return;
-                }
+            if (board->getBlocks().improvements(ab->getBlockId()) > 0) {
+                std::cout << "[Error] Cannot receive \"" << receiveStr << "\" because it or another property in its monopoly has improvements.\n";
+                return;
             }
         }
     }
@@ -142,7 +172,18 @@ void GameController::trade(const std::string& fromToken, const std::string& give
               << fromPlayer->getName() << "? (y/n): ";
 
     std::string response;
-    std::cin >> response;
+    if (const Strategy* s = getStrategy(toPlayer)) {
+        // The offer as seen by toPlayer: it receives "give" and gives "receive".
+        TradeOffer offer;
+        if (giveIsMoney) offer.cashIn = std::stoi(giveStr);
+        else offer.gets = giveBuilding;
+        if (receiveIsMoney) offer.cashOut = std::stoi(receiveStr);
+        else offer.gives = receiveBuilding;
+        response = s->acceptTrade(*toPlayer, offer, *board) ? "y" : "n";
+        std::cout << response << "\n";
+    } else {
+        std::cin >> response;
+    }
 
     if (response != "y" && response != "Y") {
         std::cout << "[Trade] Offer rejected.\n";
@@ -153,20 +194,20 @@ void GameController::trade(const std::string& fromToken, const std::string& give
         int amount = std::stoi(giveStr);
         fromPlayer->pay(amount);
         toPlayer->receive(amount);
+        publishEvent(SpectatorEventType::Transfer, fromPlayer, toPlayer, fromPlayer->getPosition(), amount);
     } else {
-        fromPlayer->removeProperty(giveStr);
-        toPlayer->addProperty(giveStr);
-        getBuilding(giveStr)->setOwnerToken(toToken);
+        transferProperty(giveBuilding, fromPlayer, toPlayer);
+        publishEvent(SpectatorEventType::Ownership, toPlayer, fromPlayer, giveBuilding->getPosition());
     }
 
     if (receiveIsMoney) {
         int amount = std::stoi(receiveStr);
         toPlayer->pay(amount);
         fromPlayer->receive(amount);
+        publishEvent(SpectatorEventType::Transfer, toPlayer, fromPlayer, toPlayer->getPosition(), amount);
     } else {
-        toPlayer->removeProperty(receiveStr);
-        fromPlayer->addProperty(receiveStr);
-        getBuilding(receiveStr)->setOwnerToken(fromToken);
+        transferProperty(receiveBuilding, toPlayer, fromPlayer);
+        publishEvent(SpectatorEventType::Ownership, fromPlayer, toPlayer, receiveBuilding->getPosition());
     }
 
     std::cout << "[Trade] " << fromPlayer->getName() << " traded " << giveStr
@@ -175,138 +216,365 @@ void GameController::trade(const std::string& fromToken, const std::string& give
 
 
 
+std::vector<TradeCandidate> GameController::evaluateTrades(const TradeWeights& weights) const {
+    std::vector<const Player*> active;
+    for (const auto& [_, p] : players) {
+        if (!p->isBankrupt()) active.push_back(p);
+    }
+    return ::evaluateTrades(*board, active, weights);
+}
+
+std::uint32_t GameController::getTraceGameId() const {
+    return traceGame;
+}
+
+void GameController::setSpectator(SpectatorChannel* s) {
+    spectator = s;
+}
+
+void GameController::setTurnStats(TurnStats* stats) {
+    turnStats = stats;
+}
+
+void GameController::setAnalytics(AnalyticsBlock* block) {
+    analytics = block;
+}
+
+void GameController::publishEvent(SpectatorEventType type, const Player* actor, const Player* other,
+                                  int square, int a, int b) {
+    if (!spectator && !scenarioLog) return;
+
+    SpectatorEvent ev;
+    ev.type = type;
+    ev.square = static_cast<std::uint8_t>(square);
+    if (actor) setEventToken(ev.actor, actor->getToken());
+    if (other) setEventToken(ev.other, other->getToken());
+    ev.a = a;
+    ev.b = b;
+    if (spectator) spectator->publish(ev);
+    if (scenarioLog) scenarioLog->record(ev, stateHash());
+}
+
+// FNV-1a over fixed-width fields, so the value is independent of padding,
+// pointer values and the platform's std::hash.
+std::uint64_t GameController::stateHash() const {
+    std::uint64_t h = 14695981039346656037ull;
+    auto mix = [&h](std::uint64_t value) {
+        for (int i = 0; i < 8; ++i) {
+            h ^= (value >> (8 * i)) & 0xff;
+            h *= 1099511628211ull;
+        }
+    };
+    auto mixText = [&mix](std::string_view text) {
+        mix(text.size());
+        for (char c : text) mix(static_cast<unsigned char>(c));
+    };
+
+    if (board) {
+        const BoardState& state = board->getState();
+        for (int pos = 0; pos < BoardState::Squares; ++pos) {
+            const Player* owner = state.ownership.ownerOf(pos);
+            mixText(owner ? owner->getToken() : std::string{});
+            mix(state.improvements[pos]);
+        }
+        mix(state.mortgaged.raw());
+    }
+    for (const auto& [token, p] : players) {
+        mixText(token);
+        mix(static_cast<std::uint32_t>(p->getMoney()));
+        mix(p->getPosition());
+        mix(p->getRollUpCups());
+        mix(p->isInTims() ? 1 + p->getTimsTurns() : 0);
+        mix(p->isBankrupt());
+    }
+    return h;
+}
+
+// Changes b's owner (either side may be nullptr, the Bank). The building
+// updates the owner table, both players' property sets and asset totals.
+void GameController::transferProperty(Building* b, Player* from, Player* to) {
+    if (b->getOwner() != from) {
+        std::cout << "[Error] " << b->getName() << " is not owned by the expected player.\n";
+        return;
+    }
+    b->setOwner(to);
+}
+
+// Rebuilds every player's asset totals from the owner table. Buildings keep
+// the totals current on their own; this is a consistency check/repair.
+void GameController::recalculateAssets() {
+    for (auto& [_, p] : players) p->resetAssets();
+
+    auto count = [](Building* b) {
+        Player* owner = b->getOwner();
+        if (!owner) return;
+        owner->adjustAssets(b->getPrice(), b->getImprovementValue(),
+                            b->isMortgaged() ? b->getUnmortgageCost() : 0);
+    };
+    for (auto* b : buildingAt) {
+        if (b) count(b);
+    }
+    for (const auto& [_, b] : buildings) count(b);
+}
+
 void GameController::setBoard(Board* b) {
     board = b;
+    for (auto& [_, p] : players) board->getOwnership().addPlayer(p);
 
-    // Populate controller's buildings map from board squares
+    // Index the board's buildings by position (getBuilding resolves names
+    // through Board::indexOf, so they need no map entries)
     for (int i = 0; i < 40; ++i) {
-        Square* sq = board->getSquare(i);
-        if (auto* bldg = dynamic_cast<Building*>(sq)) {
-            buildings[bldg->getName()] = bldg;
-        }
+        buildingAt[i] = dynamic_cast<Building*>(board->getSquare(i));
     }
 }
 
+void GameController::seed(unsigned value) {
+    rng.seed(value);
+}
+
+int GameController::nextRoll() {
+    return static_cast<int>(rng());
+}
+
+int GameController::drawRoll() {
+    if (!turn.nextDraw) return nextRoll();
+    const int roll = *turn.nextDraw;
+    turn.nextDraw.reset();
+    return roll;
+}
+
+void GameController::copyStateFrom(const GameController& src) {
+    auctionMode = src.auctionMode;
+    proxyBidSource = src.proxyBidSource;
+    strategies.clear();
+    for (const auto& [player, strategy] : src.strategies) {
+        if (Player* own = getPlayer(player->getToken())) strategies.emplace_back(own, strategy);
+    }
+    rng = src.rng;
+    turn = src.turn;
+    turn.player = src.turn.player ? getPlayer(src.turn.player->getToken()) : nullptr;
+}
+
+// Runs a whole turn (including any doubles re-rolls) to completion.
+// With forcedDice, follow-up rolls after doubles are read from std::cin.
 void GameController::playTurn(Player* p, std::optional<std::pair<int, int>> forcedDice) {
-    bool skipRoll = false;
-    bool skipExtraTurn = false;
-    bool escapedJail = false;
+    PhaseTimer timer{turnStats, StatPhase::Turn};
+    TraceGameScope traceScope{traceGame};
+    TraceSpan span{"turn", "turn"};
+    beginTurn(p, forcedDice);
+    while (stepTurn() != TurnPhase::Done) {}
+}
 
-    int die1 = 0, die2 = 0, steps = 0;
-    static int doublesStreak = 0;
+// Same as playTurn with forced dice; kept for the scenario programs.
+void GameController::simulateTurn(Player* p, int die1, int die2) {
+    playTurn(p, std::pair{die1, die2});
+}
 
-    int oldPos = p->getPosition();
-    int newPos = oldPos;
-
-    auto rollDice = [&]() {
-        if (forcedDice) {
-            die1 = forcedDice->first;
-            die2 = forcedDice->second;
-            std::cout << "[TEST] Simulating roll: " << die1 << " and " << die2
-                      << " (Total: " << die1 + die2 << ")\n";
-        } else {
-            die1 = std::rand() % 6 + 1;
-            die2 = std::rand() % 6 + 1;
-        }
-        steps = die1 + die2;
-    };
+void GameController::beginTurn(Player* p, std::optional<std::pair<int, int>> forcedDice) {
+    turn = TurnState{};
+    turn.player = p;
+    turn.forced = forcedDice.has_value();
+    if (forcedDice) {
+        turn.forcedDie1 = forcedDice->first;
+        turn.forcedDie2 = forcedDice->second;
+    }
+    turn.phase = p->isInTims() ? TurnPhase::Jail : TurnPhase::Roll;
+    if (analytics) ++analytics->turns;
+
+    publishEvent(SpectatorEventType::Turn, p, nullptr, p->getPosition());
+}
 
-    // ====== Jail Logic ======
-    if (p->isInTims()) {
-        std::cout << "[STATUS] " << p->getName()
-                  << " is in DC Tims Line (Turn " << p->getTimsTurns() + 1 << "/3) | "
-                  << "Roll Up Cups: " << p->getRollUpCups() << " | "
-                  << "Money: $" << p->getMoney() << "\n";
+// Executes exactly one phase of the current turn and returns the next one.
+TurnPhase GameController::stepTurn() {
+    TraceSpan span{phaseTraceName(turn.phase), "phase"};
+    switch (turn.phase) {
+        case TurnPhase::Jail:      turn.phase = stepJail(); break;
+        case TurnPhase::Roll:      turn.phase = stepRoll(); break;
+        case TurnPhase::Move:      turn.phase = stepMove(); break;
+        case TurnPhase::Resolve:   turn.phase = stepResolve(); break;
+        case TurnPhase::ExtraTurn: turn.phase = stepExtraTurn(); break;
+        case TurnPhase::Done:      break;
+    }
+    if (scenarioLog && turn.phase == TurnPhase::Done) scenarioLog->noteState(stateHash());
+    return turn.phase;
+}
 
-        std::string choice;
+const TurnState& GameController::getTurnState() const {
+    return turn;
+}
 
-        if (p->getRollUpCups() > 0) {
-            std::cout << "[Controller]: Use Roll Up the Rim cup? (y/n): ";
-            std::cin >> choice;
-            if (choice == "y" || choice == "Y") {
-                p->useRollUpCup();
-                p->setInTims(false);
-                p->resetTimsTurns();
-                escapedJail = true;
-                std::cout << "[ACTION] Used a Roll Up the Rim cup. Player is now free.\n";
-            }
-        }
+void GameController::setNextDice(std::optional<std::pair<int, int>> dice) {
+    turn.nextDice = dice;
+}
+
+void GameController::setNextDraw(std::optional<int> roll) {
+    turn.nextDraw = roll;
+}
+
+// Sets turn.die1/die2 from setNextDice, the forced pair or the RNG.
+void GameController::rollDice() {
+    if (turn.nextDice) {
+        turn.die1 = turn.nextDice->first;
+        turn.die2 = turn.nextDice->second;
+        turn.nextDice.reset();
+    } else if (turn.forced) {
+        turn.die1 = turn.forcedDie1;
+        turn.die2 = turn.forcedDie2;
+        std::cout << "[TEST] Simulating roll: " << turn.die1 << " and " << turn.die2
+                  << " (Total: " << turn.die1 + turn.die2 << ")\n";
+    } else {
+        turn.die1 = nextRoll() % 6 + 1;
+        turn.die2 = nextRoll() % 6 + 1;
+    }
+    publishEvent(SpectatorEventType::Dice, turn.player, nullptr, turn.player->getPosition(),
+                 turn.die1, turn.die2);
+}
+
+// Sends the current player to DC Tims Line and ends any doubles chain.
+void GameController::sendToTims(Player* p) {
+    if (p->getPosition() != 10) {
+        publishEvent(SpectatorEventType::Move, p, nullptr, 10, p->getPosition());
+    }
+    p->moveTo(10);
+    p->setInTims(true);
+    p->resetTimsTurns();
+    publishEvent(SpectatorEventType::Tims, p, nullptr, 10, 1);
+    turn.extraTurnAllowed = false;
+}
+
+// ====== Jail: cup, $50, or a roll for doubles ======
+TurnPhase GameController::stepJail() {
+    PhaseTimer timer{turnStats, StatPhase::Jail};
+    Player* p = turn.player;
+    std::cout << "[STATUS] " << p->getName()
+              << " is in DC Tims Line (Turn " << p->getTimsTurns() + 1 << "/3) | "
+              << "Roll Up Cups: " << p->getRollUpCups() << " | "
+              << "Money: $" << p->getMoney() << "\n";
+
+    std::string choice;
+    const Strategy* strategy = getStrategy(p);
 
-        if (!escapedJail && p->getMoney() >= 50) {
-            std::cout << "[Controller]: Pay $50 to get out of Tims? (y/n): ";
+    if (p->getRollUpCups() > 0) {
+        std::cout << "[Controller]: Use Roll Up the Rim cup? (y/n): ";
+        if (strategy) {
+            choice = strategy->useRollUpCup(*p, *board) ? "y" : "n";
+            std::cout << choice << "\n";
+        } else {
             std::cin >> choice;
-            if (choice == "y" || choice == "Y") {
-                enforcePayment(p, 50); // Enforcing chill as we have funds
-                p->setInTims(false);
-                p->resetTimsTurns();
-                escapedJail = true;
-                std::cout << "[ACTION] Paid $50. Player is now free.\n";
-            }
         }
-
-        if (!escapedJail && p->isInTims()) {
-            std::cout << "[Controller]: Attempting jail escape with "
-                      << (forcedDice ? "forced roll" : "random roll") << "...\n";
-            rollDice();
-            std::cout << p->getName() << " rolls " << die1 << " and " << die2 << ".\n";
-
-            if (die1 == die2) {
-                std::cout << "[SUCCESS] Doubles! " << p->getName()
-                          << " escapes jail and moves " << steps << " steps.\n";
-                p->move(steps);
-                p->setInTims(false);
-                p->resetTimsTurns();
-                skipRoll = true;
-                skipExtraTurn = true;
-            } else if (p->getTimsTurns() == 2) {
-                std::cout << "[FAIL] Third failed attempt. Paying $50 and moving " << steps << " steps.\n";
-                enforcePayment(p, 50);
-                p->move(steps);
-                p->setInTims(false);
-                p->resetTimsTurns();
-                skipRoll = true;
-                skipExtraTurn = true;
-            } else {
-                std::cout << "[FAIL] No doubles. Turn skipped.\n";
-                p->incrementTimsTurn();
-                return;
-            }
+        if (choice == "y" || choice == "Y") {
+            p->useRollUpCup();
+            p->setInTims(false);
+            p->resetTimsTurns();
+            publishEvent(SpectatorEventType::Tims, p, nullptr, p->getPosition(), 0);
+            std::cout << "[ACTION] Used a Roll Up the Rim cup. Player is now free.\n";
+            return TurnPhase::Roll;
         }
     }
 
-    // ====== Roll if not already moved ======
-    if (!skipRoll) {
-        rollDice();
-        std::cout << p->getName() << " rolled " << die1 << " and " << die2
-                  << " for a total of " << steps << ".\n";
-
-        if (die1 == die2) {
-            ++doublesStreak;
-            if (doublesStreak == 3) {
-                std::cout << "[RULE] " << p->getName() << " rolled 3 consecutive doubles. Go to DC Tims Line!\n";
-                p->moveTo(10);
-                p->setInTims(true);
-                p->resetTimsTurns();
-                doublesStreak = 0;
-                return;
-            }
+    if (p->getMoney() >= 50) {
+        std::cout << "[Controller]: Pay $50 to get out of Tims? (y/n): ";
+        if (strategy) {
+            choice = strategy->payTimsFine(*p, *board) ? "y" : "n";
+            std::cout << choice << "\n";
         } else {
-            doublesStreak = 0;
+            std::cin >> choice;
+        }
+        if (choice == "y" || choice == "Y") {
+            enforcePayment(p, 50); // Enforcing chill as we have funds
+            p->setInTims(false);
+            p->resetTimsTurns();
+            publishEvent(SpectatorEventType::Tims, p, nullptr, p->getPosition(), 0);
+            std::cout << "[ACTION] Paid $50. Player is now free.\n";
+            return TurnPhase::Roll;
         }
+    }
+
+    std::cout << "[Controller]: Attempting jail escape with "
+              << (turn.forced ? "forced roll" : "random roll") << "...\n";
+    rollDice();
+    int steps = turn.die1 + turn.die2;
+    std::cout << p->getName() << " rolls " << turn.die1 << " and " << turn.die2 << ".\n";
+
+    if (turn.die1 == turn.die2) {
+        std::cout << "[SUCCESS] Doubles! " << p->getName()
+                  << " escapes jail and moves " << steps << " steps.\n";
+    } else if (p->getTimsTurns() == 2) {
+        std::cout << "[FAIL] Third failed attempt. Paying $50 and moving " << steps << " steps.\n";
+        enforcePayment(p, 50);
+        if (p->isBankrupt()) return TurnPhase::Done;
+    } else {
+        std::cout << "[FAIL] No doubles. Turn skipped.\n";
+        p->incrementTimsTurn();
+        return TurnPhase::Done;
+    }
 
-        oldPos = p->getPosition();
-        p->move(steps);
-        newPos = p->getPosition();
+    p->setInTims(false);
+    p->resetTimsTurns();
+    publishEvent(SpectatorEventType::Tims, p, nullptr, 10, 0);
+    turn.extraTurnAllowed = false;  // leaving jail never earns a re-roll
+    return TurnPhase::Move;
+}
 
-        if (newPos < oldPos && newPos != 0) {
-            std::cout << p->getName() << " passed Collect OSAP and collects $200!\n";
-            p->receive(200);
+// ====== Roll (first roll or a doubles re-roll) ======
+TurnPhase GameController::stepRoll() {
+    PhaseTimer timer{turnStats, StatPhase::Roll};
+    Player* p = turn.player;
+    rollDice();
+    std::cout << p->getName() << " rolled " << turn.die1 << " and " << turn.die2
+              << " for a total of " << turn.die1 + turn.die2 << ".\n";
+
+    if (turn.die1 == turn.die2) {
+        if (++turn.doublesStreak == 3) {
+            std::cout << "[RULE] " << p->getName() << " rolled 3 consecutive doubles. Go to DC Tims Line!\n";
+            sendToTims(p);
+            return TurnPhase::Done;
         }
+    } else {
+        turn.doublesStreak = 0;
+    }
+    return TurnPhase::Move;
+}
+
+// ====== Move, collecting OSAP when passing it ======
+TurnPhase GameController::stepMove() {
+    PhaseTimer timer{turnStats, StatPhase::Move};
+    Player* p = turn.player;
+    int oldPos = p->getPosition();
+    p->move(turn.die1 + turn.die2);
+    int newPos = p->getPosition();
+    publishEvent(SpectatorEventType::Move, p, nullptr, newPos, oldPos);
+
+    // Landing exactly on OSAP is paid by the square itself.
+    if (newPos < oldPos && newPos != 0) {
+        std::cout << p->getName() << " passed Collect OSAP and collects $200!\n";
+        p->receive(200);
+        publishEvent(SpectatorEventType::Transfer, nullptr, p, newPos, 200);
     }
+    return TurnPhase::Resolve;
+}
 
-    // ====== Square effect ======
+// ====== Square effect ======
+TurnPhase GameController::stepResolve() {
+    Player* p = turn.player;
     Square* landed = board->getSquare(p->getPosition());
-    LandAction action = landed->onLand(p);
+    if (analytics) ++analytics->squares[landed->getPosition()].landings;
+    LandAction action;
+    {
+        PhaseTimer timer{turnStats, StatPhase::Land};
+        action = landed->onLand(p);
+
+        // SLC cards come from this game's RNG, like the dice.
+        if (action == LandAction::SLC) {
+            action = static_cast<SLC*>(landed)->draw(p, drawRoll());
+        }
+    }
+    turn.action = action;
+
+    // SLC moves the player itself; report where they ended up.
+    if (p->getPosition() != landed->getPosition()) {
+        publishEvent(SpectatorEventType::Move, p, nullptr, p->getPosition(), landed->getPosition());
+    }
 
     switch (action) {
         case LandAction::PromptPurchase: {
@@ -317,10 +585,11 @@ void GameController::playTurn(Player* p, std::optional<std::pair<int, int>> forc
         }
 
         case LandAction::PayRent: {
+            PhaseTimer timer{turnStats, StatPhase::Rent};
             auto* b = dynamic_cast<Building*>(landed);
             if (!b || b->isMortgaged()) break;
 
-            Player* owner = getPlayer(b->getOwnerToken());
+            Player* owner = b->getOwner();
             if (!owner) break;
 
             if (owner->isInTims()) {
@@ -330,20 +599,24 @@ void GameController::playTurn(Player* p, std::optional<std::pair<int, int>> forc
 
             int context = 0;
             if (dynamic_cast<Residence*>(b)) {
-                context = getResidenceCount(b->getOwnerToken());
-            } else if (dynamic_cast<Gym*>(b)) {
-                context = getGymCount(b->getOwnerToken()) * steps;
+                context = getResidenceCount(owner->getToken());
+            } else if (auto* gym = dynamic_cast<Gym*>(b)) {
+                context = gym->getMultiplier(getGymCount(owner->getToken())) * (turn.die1 + turn.die2);
             } else if (auto* ab = dynamic_cast<AcademicBuilding*>(b)) {
-                if (hasMonopoly(ab->getOwnerToken(), ab->getMonopolyBlock()) &&
-                ab->getImprovementCount() == 0) {
-                context = 1;  // signal double rent
+                if (hasMonopoly(owner, ab->getBlockId()) &&
+                    ab->getImprovementCount() == 0) {
+                    context = 1;  // signal double rent
                 }
             }
 
             int rent = b->calculateRent(context);
             std::cout << "[Controller]: " << p->getName()
                       << " must pay $" << rent << " in rent.\n";
-            enforcePayment(p, rent, owner);
+            if (enforcePayment(p, rent, owner) && analytics) {
+                SquareCounters& counts = analytics->squares[b->getPosition()];
+                ++counts.rentPayments;
+                counts.rentCollected += rent;
+            }
             break;
         }
 
@@ -354,30 +627,32 @@ void GameController::playTurn(Player* p, std::optional<std::pair<int, int>> forc
         case LandAction::GoToTims: {
             std::cout << "[Controller]: " << p->getName()
                       << " has been sent to DC Tims Line (Position 10).\n";
-            p->moveTo(10);
-            p->setInTims(true);
-            p->resetTimsTurns();
-            skipExtraTurn = true;
+            sendToTims(p);
             break;
         }
 
-        case LandAction::NEEDLESHALL: {
-            int roll = std::rand() % 18;
-            int delta = 0;
+        case LandAction::COLLECTOSAP: {
+            // Landing on square 0 has already paid out inside onLand().
+            if (landed->getPosition() == 0) {
+                publishEvent(SpectatorEventType::Transfer, nullptr, p, 0, 200);
+            }
+            std::cout << "[Controller]: No action required.\n";
+            break;
+        }
 
-            if (roll == 0) delta = -200;
-            else if (roll <= 2) delta = -100;
-            else if (roll <= 5) delta = -50;
-            else if (roll <= 11) delta = 25;
-            else if (roll <= 14) delta = 50;
-            else if (roll <= 16) delta = 100;
-            else delta = 200;
+        case LandAction::NEEDLESHALL: {
+            // One roll indexes the board's compiled Needles Hall table.
+            int delta = board->getDefinition().needlesHall.draw(drawRoll());
 
             std::cout << p->getName() << " landed on " << landed->getName()
                       << " and received a financial change of " << delta << ".\n";
 
-            if (delta >= 0) p->receive(delta);
-            else enforcePayment(p, -delta);
+            if (delta >= 0) {
+                p->receive(delta);
+                publishEvent(SpectatorEventType::Transfer, nullptr, p, p->getPosition(), delta);
+            } else {
+                enforcePayment(p, -delta);
+            }
 
             break;
         }
@@ -392,18 +667,15 @@ void GameController::playTurn(Player* p, std::optional<std::pair<int, int>> forc
             std::cout << "Enter choice (1 or 2): ";
 
             int choice = 1;
-            std::cin >> choice;
-
-            int totalWorth = p->getMoney();
-            for (const auto& [_, building] : buildings) {
-                if (building->getOwnerToken() == p->getToken()) {
-                    totalWorth += building->getPrice();
-                    if (auto* ab = dynamic_cast<AcademicBuilding*>(building)) {
-                        totalWorth += ab->getImprovementCount() * ab->getImprovementCost();
-                    }
-                }
+            if (const Strategy* s = getStrategy(p)) {
+                choice = s->payTuitionPercent(*p) ? 2 : 1;
+                std::cout << choice << "\n";
+            } else {
+                std::cin >> choice;
             }
 
+            int totalWorth = p->getTotalWorth();
+
             if (choice == 2) {
                 int fee = totalWorth / 10;
                 std::cout << "[TUITION] 10% of total worth ($" << totalWorth << ") = $" << fee << ".\n";
@@ -428,35 +700,48 @@ void GameController::playTurn(Player* p, std::optional<std::pair<int, int>> forc
             break;
     }
 
-    bool extraTurn = (die1 == die2) && !p->isInTims() && !skipExtraTurn;
-    if (extraTurn) {
-        std::cout << "[Controller]: " << p->getName()
-                  << " rolled doubles and gets another turn!\n";
+    return TurnPhase::ExtraTurn;
+}
 
-        if (forcedDice) {
-            int nextDie1, nextDie2;
-            std::cout << "[TEST INPUT]: Enter next dice roll (die1 die2): ";
-            std::cin >> nextDie1 >> nextDie2;
-            playTurn(p, std::pair{nextDie1, nextDie2});
-        } else {
-            playTurn(p);
-        }
+// ====== Doubles earn another roll ======
+TurnPhase GameController::stepExtraTurn() {
+    Player* p = turn.player;
+    bool extraTurn = (turn.die1 == turn.die2) && turn.extraTurnAllowed &&
+                     !p->isInTims() && !p->isBankrupt();
+    if (!extraTurn) return TurnPhase::Done;
+
+    std::cout << "[Controller]: " << p->getName()
+              << " rolled doubles and gets another turn!\n";
+
+    if (turn.forced) {
+        std::cout << "[TEST INPUT]: Enter next dice roll (die1 die2): ";
+        std::cin >> turn.forcedDie1 >> turn.forcedDie2;
     }
+    ++turn.rollCount;
+    return TurnPhase::Roll;
 }
 
-
 void GameController::promptPurchase(Player* p, Building* b) {
+    TraceGameScope traceScope{traceGame};
+    TraceSpan span{"purchase", "decision"};
     std::cout << "[Controller]: Would you like to buy " << b->getName()
               << " for $" << b->getPrice() << "? (y/n): ";
 
     std::string choice;
-    std::cin >> choice;
+    if (const Strategy* s = getStrategy(p)) {
+        choice = s->buy(*p, *b, *board) ? "y" : "n";
+        std::cout << choice << "\n";
+    } else {
+        std::cin >> choice;
+    }
 
     if (choice == "y" || choice == "Y") {
         if (p->getMoney() >= b->getPrice()) {
             p->pay(b->getPrice());
-            p->addProperty(b->getName());
-            b->setOwnerToken(p->getToken());
+            transferProperty(b, nullptr, p);
+            publishEvent(SpectatorEventType::Transfer, p, nullptr, b->getPosition(), b->getPrice());
+            publishEvent(SpectatorEventType::Ownership, p, nullptr, b->getPosition());
+            if (analytics) ++analytics->squares[b->getPosition()].purchases;
 
             std::cout << "[Controller]: " << p->getName() << " now owns " << b->getName() << "!\n";
         } else {
@@ -469,31 +754,21 @@ void GameController::promptPurchase(Player* p, Building* b) {
     }
 }
 
+// Residence/gym counts are a popcount of the owner's set masked by the board.
 int GameController::getResidenceCount(const std::string& ownerToken) const {
-    int count = 0;
-    for (const auto& [name, b] : buildings) {
-        if (dynamic_cast<Residence*>(b) && b->getOwnerToken() == ownerToken) {
-            ++count;
-        }
-    }
-    std::cout << "[DEBUG] Buildings in controller: " << buildings.size() << "\n";
-
-    return count;
+    Player* owner = getPlayer(ownerToken);
+    if (!owner || !board) return 0;
+    return (owner->getProperties() & board->getResidences()).size();
 }
 
 int GameController::getGymCount(const std::string& ownerToken) const {
-    int count = 0;
-    for (const auto& [name, b] : buildings) {
-        if (dynamic_cast<Gym*>(b) && b->getOwnerToken() == ownerToken) {
-            ++count;
-        }
-    }
-    std::cout << "[DEBUG] Buildings in controller: " << buildings.size() << "\n";
-    return count;
+    Player* owner = getPlayer(ownerToken);
+    if (!owner || !board) return 0;
+    return (owner->getProperties() & board->getGyms()).size();
 }
 
 bool GameController::improveBuilding(Player* p, AcademicBuilding* ab) {
-    if (ab->getOwnerToken() != p->getToken()) {
+    if (ab->getOwner() != p) {
         std::cout << "[Error] You do not own this building.\n";
         return false;
     }
@@ -508,7 +783,7 @@ bool GameController::improveBuilding(Player* p, AcademicBuilding* ab) {
         return false;
     }
 
-    if (!hasMonopoly(p->getToken(), ab->getMonopolyBlock())) {
+    if (!hasMonopoly(p, ab->getBlockId())) {
         std::cout << "[Error] You must own all buildings in the block to improve.\n";
         return false;
     }
@@ -521,6 +796,8 @@ bool GameController::improveBuilding(Player* p, AcademicBuilding* ab) {
 
     ab->addImprovement();
     p->pay(cost);
+    publishEvent(SpectatorEventType::Transfer, p, nullptr, ab->getPosition(), cost);
+    publishEvent(SpectatorEventType::Improvement, p, nullptr, ab->getPosition(), ab->getImprovementCount());
 
     std::cout << "[Success] " << ab->getName() << " improved to "
               << ab->getImprovementCount() << " level(s).\n";
@@ -528,20 +805,21 @@ bool GameController::improveBuilding(Player* p, AcademicBuilding* ab) {
     return true;
 }
 
+// Name-based entry point; resolves to the block index once.
 bool GameController::hasMonopoly(const std::string& token, const std::string& blockName) {
-    for (const auto& [name, b] : buildings) {
-        auto* ab = dynamic_cast<AcademicBuilding*>(b);
-        if (ab && ab->getMonopolyBlock() == blockName) {
-            if (ab->getOwnerToken() != token) {
-                return false;  // Player doesn't own this building in the block
-            }
-        }
-    }
-    return true;  // All buildings in block are owned by player
+    int block = board->getBlocks().find(blockName);
+    if (block == BlockIndex::None) return true;  // no such block: nothing to own
+    Player* p = getPlayer(token);
+    return p && hasMonopoly(p, block);
+}
+
+// Player owns every member of the block: one mask compare.
+bool GameController::hasMonopoly(const Player* p, int block) const {
+    return board->getBlocks().ownsAll(p->getProperties(), block);
 }
 
 bool GameController::degradeBuilding(Player* p, AcademicBuilding* ab) {
-    if (ab->getOwnerToken() != p->getToken()) {
+    if (ab->getOwner() != p) {
         std::cout << "[Error] You do not own this building.\n";
         return false;
     }
@@ -554,6 +832,8 @@ bool GameController::degradeBuilding(Player* p, AcademicBuilding* ab) {
     ab->removeImprovement();
     int refund = ab->getImprovementCost() / 2;
     p->receive(refund);
+    publishEvent(SpectatorEventType::Transfer, nullptr, p, ab->getPosition(), refund);
+    publishEvent(SpectatorEventType::Improvement, p, nullptr, ab->getPosition(), ab->getImprovementCount());
 
     std::cout << "[Success] Sold 1 improvement from " << ab->getName()
               << ". New level: " << ab->getImprovementCount()
@@ -569,7 +849,7 @@ bool GameController::mortgageBuilding(Player* p, Building* b) {
         return false;
     }
 
-    if (b->getOwnerToken() != p->getToken()) {
+    if (b->getOwner() != p) {
         std::cout << "[Error] You don't own " << b->getName() << ".\n";
         return false;
     }
@@ -588,16 +868,9 @@ bool GameController::mortgageBuilding(Player* p, Building* b) {
     }
 
     if (auto* ab = dynamic_cast<AcademicBuilding*>(b)) {
-        std::string block = ab->getMonopolyBlock();
-
-        for (const auto& [name, bldg] : buildings) {
-            auto* other = dynamic_cast<AcademicBuilding*>(bldg);
-            if (other && other->getMonopolyBlock() == block) {
-                if (other->getImprovementCount() > 0) {
-                    std::cout << "[Error] Cannot mortgage: other properties in the block have improvements.\n";
-                    return false;
-                }
-            }
+        if (board->getBlocks().improvements(ab->getBlockId()) > 0) {
+            std::cout << "[Error] Cannot mortgage: other properties in the block have improvements.\n";
+            return false;
         }
     }
 
@@ -605,6 +878,9 @@ bool GameController::mortgageBuilding(Player* p, Building* b) {
     b->setMortgaged(true);
     int value = b->getPrice() / 2;
     p->receive(value);
+    publishEvent(SpectatorEventType::Transfer, nullptr, p, b->getPosition(), value);
+    publishEvent(SpectatorEventType::Mortgage, p, nullptr, b->getPosition(), 1);
+    if (analytics) ++analytics->squares[b->getPosition()].mortgages;
 
     std::cout << "[Success] " << b->getName() << " mortgaged for $" << value << ".\n";
     return true;
@@ -617,7 +893,7 @@ bool GameController::unmortgageBuilding(Player* p, Building* b) {
         return false;
     }
     
-    if (b->getOwnerToken() != p->getToken()) {
+    if (b->getOwner() != p) {
         std::cout << "[Error] You don't own " << b->getName() << ".\n";
         return false;
     }
@@ -627,7 +903,7 @@ bool GameController::unmortgageBuilding(Player* p, Building* b) {
         return false;
     }
 
-    int repay = (b->getPrice() / 2) * 1.1;  // 10% interest
+    int repay = b->getUnmortgageCost();  // 10% interest
     if (p->getMoney() < repay) {
         std::cout << "[Error] Not enough money to unmortgage.\n";
         return false;
@@ -635,194 +911,172 @@ bool GameController::unmortgageBuilding(Player* p, Building* b) {
 
     b->setMortgaged(false);
     p->pay(repay);
+    publishEvent(SpectatorEventType::Transfer, p, nullptr, b->getPosition(), repay);
+    publishEvent(SpectatorEventType::Mortgage, p, nullptr, b->getPosition(), 0);
 
     std::cout << "[Success] " << b->getName() << " unmortgaged for $" << repay << ".\n";
     return true;
 }
 
-void GameController::simulateTurn(Player* p, int forcedDie1, int forcedDie2) {
-    bool skipRoll = false;
-    bool skipExtraTurn = false;
-    bool escapedJail = false;
-    int die1 = forcedDie1, die2 = forcedDie2, steps = die1 + die2;
-    int oldPos = p->getPosition();
-    int newPos = oldPos;
-
-    std::cout << "[TEST] Simulating roll: " << die1 << " and " << die2
-              << " (Total: " << steps << ")\n";
-
-    if (p->isInTims()) {
-        std::cout << "[STATUS] " << p->getName()
-            << " is in DC Tims Line (Turn " << p->getTimsTurns() + 1 << "/3) | "
-            << "Roll Up Cups: " << p->getRollUpCups() << " | "
-            << "Money: $" << p->getMoney() << "\n";
-
-        std::string choice;
-
-        // === Option 1: Use Roll Up the Rim Cup ===
-        if (p->getRollUpCups() > 0) {
-            std::cout << "[Controller]: Use Roll Up the Rim cup? (y/n): ";
-            std::cin >> choice;
-            if (choice == "y" || choice == "Y") {
-                p->useRollUpCup();
-                p->setInTims(false);
-                p->resetTimsTurns();
-                escapedJail = true;
-                std::cout << "[ACTION] Used a Roll Up the Rim cup. Player is now free.\n";
-            }
-        }
+void GameController::setAuctionMode(AuctionMode mode) {
+    auctionMode = mode;
+}
 
-        // === Option 2: Pay $50 to escape early ===
-        if (!escapedJail && p->getMoney() >= 50) {
-            std::cout << "[Controller]: Pay $50 to get out of Tims? (y/n): ";
-            std::cin >> choice;
-            if (choice == "y" || choice == "Y") {
-                p->pay(50);
-                p->setInTims(false);
-                p->resetTimsTurns();
-                escapedJail = true;
-                std::cout << "[ACTION] Paid $50. Player is now free.\n";
-            }
-        }
+void GameController::setProxyBidSource(std::function<int(const Player*, const Building*)> source) {
+    proxyBidSource = std::move(source);
+}
 
-        // === Option 3: Try to roll doubles ===
-        if (!escapedJail && p->isInTims()) {
-            std::cout << "[Controller]: Attempting jail escape with forced roll...\n";
-            std::cout << p->getName() << " rolls " << die1 << " and " << die2 << ".\n";
-
-            if (die1 == die2) {
-                std::cout << "[SUCCESS] Doubles! " << p->getName()
-                    << " escapes jail and moves " << (die1 + die2) << " steps.\n";
-                p->move(die1 + die2);
-                p->setInTims(false);
-                p->resetTimsTurns();
-
-                skipRoll = true;
-                skipExtraTurn = true;
-            } else if (p->getTimsTurns() == 2) {
-                std::cout << "[FAIL] Third failed attempt. Paying $50 and moving " << (die1 + die2) << " steps.\n";
-                p->pay(50);
-                p->move(die1 + die2);
-                p->setInTims(false);
-                p->resetTimsTurns();
-
-                skipRoll = true;
-                skipExtraTurn = true;
-            } else {
-                std::cout << "[FAIL] No doubles. Turn skipped.\n";
-                p->incrementTimsTurn();
-                return;  // End turn
-            }
-        }
+// At most eight seats, so a linear scan beats any map.
+void GameController::setStrategy(const Player* p, const Strategy* s) {
+    auto it = std::find_if(strategies.begin(), strategies.end(),
+                           [p](const auto& seat) { return seat.first == p; });
+    if (it != strategies.end()) {
+        if (s) it->second = s;
+        else strategies.erase(it);
+    } else if (s) {
+        strategies.emplace_back(p, s);
     }
+}
 
-    if (!skipRoll) {
-        oldPos = p->getPosition();
-        p->move(steps);
-        newPos = p->getPosition();
+const Strategy* GameController::getStrategy(const Player* p) const {
+    for (const auto& [player, strategy] : strategies) {
+        if (player == p) return strategy;
+    }
+    return nullptr;
+}
 
-        if (newPos < oldPos) {
-            std::cout << p->getName() << " passed Collect OSAP and collects $200!\n";
-            p->receive(200);
+// After the turn, offers the strategy each improvement p could legally
+// buy, in board order, until it declines them all or p runs short.
+void GameController::playBotTurn(Player* p) {
+    playTurn(p);
+    const Strategy* strategy = getStrategy(p);
+    if (!strategy || p->isBankrupt()) return;
+
+    bool built = true;
+    while (built) {
+        built = false;
+        for (int pos : p->getProperties()) {
+            auto* ab = dynamic_cast<AcademicBuilding*>(buildingAt[pos]);
+            if (!ab || ab->isMortgaged() || ab->getImprovementCount() >= 5) continue;
+            if (!hasMonopoly(p, ab->getBlockId()) || p->getMoney() < ab->getImprovementCost()) continue;
+            if (strategy->improve(*p, *ab, *board) && improveBuilding(p, ab)) built = true;
         }
     }
+}
 
-    Square* landed = board->getSquare(p->getPosition());
-    LandAction action = landed->onLand(p);
+// Bidders are every active player in token order, which also fixes the
+// tie-break order for proxy auctions.
+void GameController::handleAuction(Building* b) {
+    PhaseTimer timer{turnStats, StatPhase::Auction};
+    TraceGameScope traceScope{traceGame};
+    TraceSpan span{"auction", "decision"};
+    std::cout << "[Auction] " << b->getName() << " is now up for auction!\n";
 
-    switch (action) {
-        case LandAction::PromptPurchase: {
-            if (auto* b = dynamic_cast<Building*>(landed)) {
-                promptPurchase(p, b);
-            }
-            break;
+    std::pmr::vector<Player*>& bidders = auctionBidders;
+    bidders.clear();
+    for (const auto& [token, player] : players) {
+        if (!player->isBankrupt()) {
+            bidders.push_back(player);
         }
+    }
 
-        case LandAction::PayRent: {
-            auto* b = dynamic_cast<Building*>(landed);
-            if (!b || b->isMortgaged()) break;
-
-            int context = 0;
-            if (dynamic_cast<Residence*>(b)) {
-                context = getResidenceCount(b->getOwnerToken());
-            } else if (dynamic_cast<Gym*>(b)) {
-                context = getGymCount(b->getOwnerToken()) * steps;
-            }
-
-            int rent = b->calculateRent(context);
-            std::cout << "[Controller]: " << p->getName()
-                      << " must pay $" << rent << " in rent.\n";
-            p->pay(rent);
-            getPlayer(b->getOwnerToken())->receive(rent);
-            break;
-        }
+    if (bidders.empty()) {
+        std::cout << "[Auction] No players available to bid.\n";
+        return;
+    }
 
-        case LandAction::Owned:
-            std::cout << "[Controller]: You landed on your own property. Nothing to do.\n";
-            break;
+    if (auctionMode == AuctionMode::Interactive) {
+        runInteractiveAuction(b, bidders);
+    } else {
+        runProxyAuction(b, bidders);
+    }
+}
 
-        case LandAction::GoToTims: {
-            std::cout << "[Controller]: " << p->getName()
-                      << " has been sent to DC Tims Line (Position 10).\n";
-            p->moveTo(10);
-            p->setInTims(true);
-            p->resetTimsTurns();
-            skipExtraTurn = true;
-            break;
+// Single pass over the maxima keeping the best and runner-up.
+AuctionResult GameController::resolveProxyAuction(std::span<const int> maxima, AuctionMode rule) {
+    AuctionResult result;
+    int runnerUp = 0;
+    for (std::size_t i = 0; i < maxima.size(); ++i) {
+        if (result.winner < 0 || maxima[i] > maxima[result.winner]) {
+            if (result.winner >= 0) runnerUp = maxima[result.winner];
+            result.winner = static_cast<int>(i);
+        } else if (maxima[i] > runnerUp) {
+            runnerUp = maxima[i];
         }
-
-        default:
-            std::cout << "[Controller]: No action required.\n";
-            break;
     }
+    if (result.winner < 0) return result;
 
-    bool extraTurn = (die1 == die2) && !p->isInTims() && !skipExtraTurn;
-    if (extraTurn) {
-        std::cout << "[Controller]: " << p->getName()
-            << " rolled doubles and gets another turn!\n";
-
-        int nextDie1, nextDie2;
-        std::cout << "[TEST INPUT]: Enter next dice roll (die1 die2): ";
-        std::cin >> nextDie1 >> nextDie2;
-
-        simulateTurn(p, nextDie1, nextDie2);
+    int top = maxima[result.winner];
+    if (rule == AuctionMode::ProxyEnglish && maxima.size() > 1) {
+        result.price = std::min(top, runnerUp + 1);
+    } else {
+        result.price = maxima.size() > 1 ? runnerUp : 0;
     }
+    // Nobody wanted it: same as everyone passing in the interactive auction.
+    if (top <= 0) result.price = 0;
+    return result;
 }
 
-void GameController::handleAuction(Building* b) {
-    std::cout << "[Auction] " << b->getName() << " is now up for auction!\n";
-
-    struct Bidder {
-        Player* p;
-        bool active = true;
-    };
+AuctionResult GameController::resolveProxyAuction(const std::vector<int>& maxima, AuctionMode rule) {
+    return resolveProxyAuction(std::span<const int>{maxima}, rule);
+}
 
-    std::vector<Bidder> bidders;
-    for (const auto& [token, player] : players) {
-        if (!player->isBankrupt()) {
-            bidders.push_back({player});
+// Each bidder states a maximum once; no rounds.
+void GameController::runProxyAuction(Building* b, std::pmr::vector<Player*>& bidders) {
+    std::pmr::vector<int>& maxima = auctionMaxima;
+    maxima.clear();
+
+    for (auto* p : bidders) {
+        int bid = 0;
+        if (proxyBidSource) {
+            bid = proxyBidSource(p, b);
+        } else if (const Strategy* s = getStrategy(p)) {
+            bid = s->maxBid(*p, *b, *board);
+        } else {
+            std::string input;
+            while (true) {
+                std::cout << "[Auction] " << p->getName()
+                          << " (Balance: $" << p->getMoney() << "), enter your maximum bid (0 to pass): ";
+                std::cin >> input;
+                if (!input.empty() && std::all_of(input.begin(), input.end(), ::isdigit)) break;
+                std::cout << "[Error] Invalid input. Please enter a non-negative number.\n";
+            }
+            bid = std::stoi(input);
         }
+        maxima.push_back(std::clamp(bid, 0, std::max(0, p->getMoney())));
     }
 
-    if (bidders.empty()) {
-        std::cout << "[Auction] No players available to bid.\n";
-        return;
-    }
+    AuctionResult result = resolveProxyAuction(maxima, auctionMode);
+    awardAuction(b, bidders[result.winner], result.price);
+}
+
+void GameController::runInteractiveAuction(Building* b, std::pmr::vector<Player*>& bidders) {
+    std::pmr::vector<char>& active = auctionActive;
+    active.assign(bidders.size(), true);
 
     int highestBid = 0;
     Player* highestBidder = nullptr;
 
     while (true) {
-        for (auto& bidder : bidders) {
-            if (!bidder.active) continue;
+        for (std::size_t i = 0; i < bidders.size(); ++i) {
+            if (!active[i]) continue;
+            Player* bidder = bidders[i];
 
             int bid = -1;
             std::string input;
 
             while (true) {
-                std::cout << "[Auction] " << bidder.p->getName()
-                          << " (Balance: $" << bidder.p->getMoney() << "), enter bid (0 to pass): ";
-                std::cin >> input;
+                std::cout << "[Auction] " << bidder->getName()
+                          << " (Balance: $" << bidder->getMoney() << "), enter bid (0 to pass): ";
+                if (const Strategy* s = getStrategy(bidder)) {
+                    // Raise by $10 while under the strategy's maximum.
+                    int limit = std::min(s->maxBid(*bidder, *b, *board), bidder->getMoney());
+                    int raise = std::min(highestBid + 10, limit);
+                    input = std::to_string(raise > highestBid ? raise : 0);
+                    std::cout << input << "\n";
+                } else {
+                    std::cin >> input;
+                }
 
                 bool valid = !input.empty() && std::all_of(input.begin(), input.end(), ::isdigit);
                 if (!valid) {
@@ -833,7 +1087,7 @@ void GameController::handleAuction(Building* b) {
                 bid = std::stoi(input);
 
                 if (bid == 0) {
-                    bidder.active = false;
+                    active[i] = false;
                     break;
                 }
 
@@ -842,23 +1096,20 @@ void GameController::handleAuction(Building* b) {
                     continue;
                 }
 
-                if (bid > bidder.p->getMoney()) {
+                if (bid > bidder->getMoney()) {
                     std::cout << "[Error] You don't have enough money. You're out.\n";
-                    bidder.active = false;
+                    active[i] = false;
                     break;
                 }
 
                 // Valid bid
                 highestBid = bid;
-                highestBidder = bidder.p;
+                highestBidder = bidder;
                 break;
             }
 
             // ✅ Early exit if only one bidder remains
-            int activeCount = 0;
-            for (const auto& b : bidders) {
-                if (b.active) ++activeCount;
-            }
+            int activeCount = static_cast<int>(std::count(active.begin(), active.end(), true));
             if (activeCount <= 1) goto AUCTION_END;
         }
     }
@@ -867,9 +1118,9 @@ void GameController::handleAuction(Building* b) {
         // If only one active bidder remains and no bid was placed,
         // auto-assign property for $0
         if (!highestBidder) {
-            for (auto& bidder : bidders) {
-                if (bidder.active) {
-                    highestBidder = bidder.p;
+            for (std::size_t i = 0; i < bidders.size(); ++i) {
+                if (active[i]) {
+                    highestBidder = bidders[i];
                     highestBid = 0;
                     std::cout << "[Auction] Only one player remained. Property goes to "
                       << highestBidder->getName() << " for FREE.\n";
@@ -878,29 +1129,43 @@ void GameController::handleAuction(Building* b) {
             }
         }
 
-        highestBidder->pay(highestBid);
-        highestBidder->addProperty(b->getName());
-        b->setOwnerToken(highestBidder->getToken());
+        awardAuction(b, highestBidder, highestBid);
+}
+
+void GameController::awardAuction(Building* b, Player* winner, int price) {
+    winner->pay(price);
+    transferProperty(b, nullptr, winner);
+    publishEvent(SpectatorEventType::Transfer, winner, nullptr, b->getPosition(), price);
+    publishEvent(SpectatorEventType::Ownership, winner, nullptr, b->getPosition());
+    if (analytics) {
+        SquareCounters& counts = analytics->squares[b->getPosition()];
+        ++counts.auctions;
+        counts.auctionTotal += price;
+        if (static_cast<std::uint64_t>(price) > counts.auctionMax) counts.auctionMax = price;
+    }
 
-    std::cout << "[Auction] " << highestBidder->getName()
+    std::cout << "[Auction] " << winner->getName()
               << " wins the auction for " << b->getName()
-              << " at $" << highestBid << "!\n";
+              << " at $" << price << "!\n";
 }
 
 void GameController::declareBankruptcy(Player* debtor, Player* creditor) {
+    if (analytics) ++analytics->squares[debtor->getPosition()].bankruptcies;
     std::cout << "[BANKRUPTCY] " << debtor->getName()
               << " is declaring bankruptcy"
               << (creditor ? " to " + creditor->getName() : " to the Bank") << ".\n";
 
-    // === Transfer all properties ===
-    for (auto& [name, b] : buildings) {
-        if (b->getOwnerToken() != debtor->getToken()) continue;
+    // === Transfer all properties (iterate a copy; transfers edit the set) ===
+    const PropertySet owned = debtor->getProperties();
+    for (int pos : owned) {
+        auto* b = dynamic_cast<Building*>(board->getSquare(pos));
+        if (!b) continue;
+        const std::string& name = b->getName();
 
         if (creditor) {
             // Bankruptcy to another player
-            b->setOwnerToken(creditor->getToken());
-            creditor->addProperty(name);
-            debtor->removeProperty(name);
+            transferProperty(b, debtor, creditor);
+            publishEvent(SpectatorEventType::Ownership, creditor, debtor, b->getPosition());
 
             std::cout << "[TRANSFER] " << name << " transferred to " << creditor->getName() << ".\n";
 
@@ -910,12 +1175,13 @@ void GameController::declareBankruptcy(Player* debtor, Player* creditor) {
                           << creditor->getName() << " must pay $"
                           << interest << " in interest to the Bank.\n";
                 creditor->pay(interest);
+                publishEvent(SpectatorEventType::Transfer, creditor, nullptr, b->getPosition(), interest);
             }
         } else {
             // Bankruptcy to the Bank — return to open market
-            b->setOwnerToken("BANK");
+            transferProperty(b, debtor, nullptr);
             b->setMortgaged(false);
-            debtor->removeProperty(name);
+            publishEvent(SpectatorEventType::Ownership, nullptr, debtor, b->getPosition());
             std::cout << "[RESET] " << name << " returned to Bank.\n";
         }
     }
@@ -937,18 +1203,22 @@ void GameController::declareBankruptcy(Player* debtor, Player* creditor) {
     if (creditor && moneyLeft > 0) {
         debtor->pay(moneyLeft);
         creditor->receive(moneyLeft);
+        publishEvent(SpectatorEventType::Transfer, debtor, creditor, debtor->getPosition(), moneyLeft);
         std::cout << "[TRANSFER] $" << moneyLeft << " transferred to " << creditor->getName() << ".\n";
     }
 
     // === Mark debtor as bankrupt ===
     debtor->setBankrupt(true);
+    publishEvent(SpectatorEventType::Bankrupt, debtor, creditor, debtor->getPosition());
     std::cout << "[STATUS] " << debtor->getName() << " is now out of the game.\n";
 }
 
 bool GameController::enforcePayment(Player* debtor, int amount, Player* creditor) {
+    PhaseTimer timer{turnStats, StatPhase::Payment};
     if (debtor->getMoney() >= amount) {
         debtor->pay(amount);
         if (creditor) creditor->receive(amount);
+        publishEvent(SpectatorEventType::Transfer, debtor, creditor, debtor->getPosition(), amount);
         return true;
     }
 
@@ -960,6 +1230,7 @@ bool GameController::enforcePayment(Player* debtor, int amount, Player* creditor
         std::cout << "[Recovery] " << debtor->getName() << " raised enough money. Paying...\n";
         debtor->pay(amount);
         if (creditor) creditor->receive(amount);
+        publishEvent(SpectatorEventType::Transfer, debtor, creditor, debtor->getPosition(), amount);
         return true;
     }
 
@@ -969,6 +1240,8 @@ bool GameController::enforcePayment(Player* debtor, int amount, Player* creditor
 }
 
 bool GameController::attemptToRaiseFunds(Player* p, int amountOwed) {
+    TraceGameScope traceScope{traceGame};
+    TraceSpan span{"raise funds", "decision"};
     std::cout << "\n💸 [Bankruptcy Warning] " << p->getName() << " owes $" << amountOwed << ".\n";
     std::cout << "💰 Current funds: $" << p->getMoney() << "\n";
     int deficit = amountOwed - p->getMoney();
@@ -977,14 +1250,17 @@ bool GameController::attemptToRaiseFunds(Player* p, int amountOwed) {
         return true;
     }
 
+    if (getStrategy(p)) return raiseFundsAutomatically(p, amountOwed);
+
     std::cout << "❗ You are short by $" << deficit << ". You must raise funds manually.\n";
 
     while (p->getMoney() < amountOwed) {
         std::vector<AcademicBuilding*> improvable;
         std::vector<Building*> mortgageable;
 
-        for (const auto& [name, b] : buildings) {
-            if (b->getOwnerToken() != p->getToken()) continue;
+        for (int pos : p->getProperties()) {
+            auto* b = dynamic_cast<Building*>(board->getSquare(pos));
+            if (!b) continue;
 
             if (auto* ab = dynamic_cast<AcademicBuilding*>(b)) {
                 if (ab->getImprovementCount() > 0) {
@@ -1006,7 +1282,8 @@ bool GameController::attemptToRaiseFunds(Player* p, int amountOwed) {
         std::cout << "1. Sell an Improvement\n";
         std::cout << "2. Mortgage a Property\n";
         std::cout << "3. Quit and declare bankruptcy\n";
-        std::cout << "Enter your choice (1-3): ";
+        std::cout << "4. Auto-liquidate (least rent lost)\n";
+        std::cout << "Enter your choice (1-4): ";
 
         int choice;
         std::cin >> choice;
@@ -1067,6 +1344,12 @@ bool GameController::attemptToRaiseFunds(Player* p, int amountOwed) {
             return false;
         }
 
+        else if (choice == 4) {
+            if (!raiseFundsAutomatically(p, amountOwed)) {
+                std::cout << "[Error] Selling everything still would not cover the debt.\n";
+            }
+        }
+
         else {
             std::cout << "[Error] Invalid choice. Please try again.\n";
         }
@@ -1077,9 +1360,33 @@ bool GameController::attemptToRaiseFunds(Player* p, int amountOwed) {
     return true;
 }
 
+bool GameController::raiseFundsAutomatically(Player* p, int amountOwed) {
+    TraceGameScope traceScope{traceGame};
+    TraceSpan span{"raise funds (auto)", "decision"};
+    LiquidationPlan plan = planLiquidation(p, *board, amountOwed - p->getMoney());
+    if (!plan.feasible) return false;
+
+    std::cout << "[Liquidation] Raising $" << plan.cashRaised << " in "
+              << plan.actions.size() << " step(s), giving up $" << plan.rentLost
+              << " of rent value.\n";
+
+    for (const auto& action : plan.actions) {
+        if (action.step == LiquidationStep::SellImprovement) {
+            degradeBuilding(p, static_cast<AcademicBuilding*>(action.building));
+        } else {
+            mortgageBuilding(p, action.building);
+        }
+    }
+    return p->getMoney() >= amountOwed;
+}
+
 void GameController::printAssets(Player* p) {
     std::cout << "\n💼 Assets for " << p->getName() << " [" << p->getToken() << "]\n";
     std::cout << "💰 Money: $" << p->getMoney() << "\n";
+    std::cout << "📈 Net Worth: $" << p->getNetWorth()
+              << " (Properties: $" << p->getPropertyValue()
+              << " | Improvements: $" << p->getImprovementValue()
+              << " | Mortgages: -$" << p->getMortgageLiability() << ")\n";
     std::cout << "🥤 Roll Up Cups: " << p->getRollUpCups() << "\n";
     
     const auto& props = p->getProperties();
@@ -1087,9 +1394,9 @@ void GameController::printAssets(Player* p) {
         std::cout << "🏠 No properties owned.\n";
     } else {
         std::cout << "🏠 Properties:\n";
-        for (const auto& name : props) {
-            Building* b = getBuilding(name);
-            std::cout << "  - " << name;
+        for (int pos : props) {
+            auto* b = dynamic_cast<Building*>(board->getSquare(pos));
+            std::cout << "  - " << b->getName();
             if (auto* ab = dynamic_cast<AcademicBuilding*>(b)) {
                 std::cout << " | Improvements: " << ab->getImprovementCount();
             }
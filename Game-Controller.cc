@@ -21,9 +21,18 @@ export module GameController;
 import LandAction;
 import <string>;
 import <map>;
+import <memory_resource>;
+import <string_view>;
 import <iostream>;
+import <array>;
+import <cstdint>;
+import <functional>;
+import <memory>;
 import <optional>;
+import <random>;
+import <span>;
 import <utility>;
+import <vector>;
 import Player;
 import Building;
 import Residence;
@@ -31,17 +40,130 @@ import AcademicBuilding;
 import Gym;
 import Board;
 import new_Display;
+import Spectator;
+import Liquidation;
+import TradeEngine;
+import BlockIndex;
+import TurnStats;
+import GameAnalytics;
+import ScenarioLog;
+import Trace;
+import Strategy;
+
+// Phases of a single turn. A turn starts at Jail (player in DC Tims Line) or
+// Roll, and ExtraTurn loops back to Roll after doubles.
+export enum class TurnPhase {
+    Jail,       // Tims options: cup, pay $50, or roll for doubles
+    Roll,       // roll dice; three doubles in a row sends the player to Tims
+    Move,       // advance and collect OSAP when passing it
+    Resolve,    // onLand() and the controller's response to its LandAction
+    ExtraTurn,  // doubles earn another Roll
+    Done
+};
+
+// How handleAuction runs. Interactive asks each bidder round by round;
+// the proxy rules take one sealed maximum per bidder and settle in one pass.
+export enum class AuctionMode {
+    Interactive,
+    ProxyEnglish,      // winner pays $1 over the runner-up's maximum (capped at own)
+    ProxySecondPrice   // winner pays the runner-up's maximum
+};
+
+// Outcome of a proxy auction. winner indexes the maxima passed in.
+export struct AuctionResult {
+    int winner = -1;   // -1 when there were no bidders
+    int price = 0;
+};
+
+// Everything the turn state machine needs between steps. Plain value, no heap.
+export struct TurnState {
+    Player* player = nullptr;
+    TurnPhase phase = TurnPhase::Done;
+    LandAction action = LandAction::None;  // result of the last Resolve
+    int die1 = 0;
+    int die2 = 0;
+    int doublesStreak = 0;
+    int rollCount = 0;            // re-rolls taken this turn
+    bool extraTurnAllowed = true; // cleared by jail escapes and being sent to Tims
+    bool forced = false;          // dice come from the caller / std::cin
+    int forcedDie1 = 0;
+    int forcedDie2 = 0;
+    std::optional<std::pair<int, int>> nextDice;  // setNextDice: the next roll only
+    std::optional<int> nextDraw;                  // setNextDraw: the next card roll only
+};
+
+// Orders the controller's name maps, and lets them be searched with any
+// string type (no temporary key per lookup).
+export struct NameLess {
+    using is_transparent = void;
+    bool operator()(std::string_view a, std::string_view b) const { return a < b; }
+};
 
 export class GameController {
 private:
     // Maps player token strings to Player* instances
-    std::map<std::string, Player*> players;
+    std::pmr::map<std::pmr::string, Player*, NameLess> players;
+
+    // Buildings registered with addBuilding() that are not board squares
+    std::pmr::map<std::pmr::string, Building*, NameLess> buildings;
+
+    // Board buildings by position, so getBuilding is a hash plus an index
+    std::array<Building*, 40> buildingAt{};
+    Board* board = nullptr;  // NEW: pointer to the board
+    SpectatorChannel* spectator = nullptr;  // Optional live feed (not owned)
+    TurnStats* turnStats = nullptr;         // Optional phase timings (not owned)
+    AnalyticsBlock* analytics = nullptr;    // Optional counters (not owned)
+    std::unique_ptr<ScenarioLog> scenarioLog;  // Only under run-scenarios (see ScenarioLog)
+    std::uint32_t traceGame;                   // This game's ID in trace spans
+
+    AuctionMode auctionMode = AuctionMode::Interactive;
+    std::function<int(const Player*, const Building*)> proxyBidSource;  // empty: ask std::cin
+
+    // Computer-controlled seats (not owned); every other player is human.
+    std::pmr::vector<std::pair<const Player*, const Strategy*>> strategies;
+
+    // Scratch for auctions, reused so that running one allocates nothing.
+    std::pmr::vector<Player*> auctionBidders;
+    std::pmr::vector<int> auctionMaxima;        // proxy auctions: each bidder's maximum
+    std::pmr::vector<char> auctionActive;       // interactive auctions: still bidding
+
+    void runInteractiveAuction(Building* b, std::pmr::vector<Player*>& bidders);
+    void runProxyAuction(Building* b, std::pmr::vector<Player*>& bidders);
+    void awardAuction(Building* b, Player* winner, int price);
+
+    // Publishes a delta event to the spectator feed and the scenario log;
+    // no-op when neither is attached.
+    void publishEvent(SpectatorEventType type, const Player* actor, const Player* other,
+                      int square, int a = 0, int b = 0);
+
+    TurnState turn;  // the turn in progress (phase == Done when idle)
+
+    // This game's dice, SLC and Needles Hall rolls. A plain value (one
+    // word of state), so forking a game copies it with everything else.
+    std::minstd_rand rng;
+    int nextRoll();
+    int drawRoll();  // turn.nextDraw if set, else nextRoll()
+
+    // One handler per TurnPhase; each returns the phase to run next.
+    TurnPhase stepJail();
+    TurnPhase stepRoll();
+    TurnPhase stepMove();
+    TurnPhase stepResolve();
+    TurnPhase stepExtraTurn();
+    void rollDice();
+    void sendToTims(Player* p);
 
-    // Maps building names to Building* instances
-    std::map<std::string, Building*> buildings;
-    Board* board;  // NEW: pointer to the board
+    // Changes b's owner (nullptr = Bank) and moves its value between the
+    // players' running asset totals.
+    void transferProperty(Building* b, Player* from, Player* to);
 
 public:
+    // The controller's maps are stored with memory (a game's arena).
+    explicit GameController(std::pmr::memory_resource* memory = std::pmr::get_default_resource());
+
+    // Appends the scenario log, when recording (see ScenarioLog).
+    ~GameController();
+
     // Registers a player with the controller (must be unique token).
     void addPlayer(Player* p);
 
@@ -60,6 +182,10 @@ public:
     void trade(const std::string& fromToken, const std::string& giveBuilding,
                const std::string& toToken, const std::string& receiveBuilding);
 
+    // Scores every candidate trade between the players still in the game
+    // (see TradeEngine). Mutually acceptable trades only, best first.
+    std::vector<TradeCandidate> evaluateTrades(const TradeWeights& weights = {}) const;
+
     // Retrieves a Player pointer by token string (e.g., "V", "B").
     Player* getPlayer(const std::string& token) const;
 
@@ -68,8 +194,47 @@ public:
 
     void setBoard(Board* b);  // Inject the board from main
 
+    // Restarts this game's RNG (default seed 1, like an unseeded std::rand).
+    void seed(unsigned value);
+
+    // Takes over src's auction rules, proxy bid source, strategies, RNG
+    // state and turn in progress (see Game::fork). The board and players must already be
+    // registered; src's players are matched to these by token. The
+    // spectator feed, turn statistics and analytics block are not copied.
+    void copyStateFrom(const GameController& src);
+
+    // Attaches (or detaches, with nullptr) a spectator feed. Not owned.
+    void setSpectator(SpectatorChannel* s);
+
+    // Records per-phase turn latencies into stats (nullptr: off). Not owned.
+    // Only takes effect in builds with WATOPOLY_TURN_STATS (see TurnStats).
+    void setTurnStats(TurnStats* stats);
+
+    // Counts landings, rent, purchases, auctions, mortgages and bankruptcies
+    // per square into block (nullptr: off). Not owned; the block must only
+    // be written by the thread running this game (see AnalyticsBatch).
+    void setAnalytics(AnalyticsBlock* block);
+
+    // Identifies this game in trace spans (see Trace). Unique per
+    // controller, so forks and parallel games get their own.
+    std::uint32_t getTraceGameId() const;
+
+    // Plays a full turn for p: beginTurn() followed by stepTurn() until Done.
     void playTurn(Player* p, std::optional<std::pair<int, int>> forcedDice = std::nullopt);
 
+    // Fine-grained stepping: beginTurn() sets up a turn, and each stepTurn()
+    // runs one phase and returns the next (TurnPhase::Done when finished).
+    void beginTurn(Player* p, std::optional<std::pair<int, int>> forcedDice = std::nullopt);
+    TurnPhase stepTurn();
+    const TurnState& getTurnState() const;
+
+    // For the turn in progress: the next dice, or the roll behind the next
+    // SLC card or Needles Hall amount (a slot of the board's table), taken
+    // from here instead of the RNG, once. std::nullopt takes back one the
+    // turn has not used.
+    void setNextDice(std::optional<std::pair<int, int>> dice);
+    void setNextDraw(std::optional<int> roll);
+
 
     void promptPurchase(Player* p, Building* b);
 
@@ -79,17 +244,56 @@ public:
     bool improveBuilding(Player* p, AcademicBuilding* ab);
 
     bool hasMonopoly(const std::string& token, const std::string& blockName);
+    bool hasMonopoly(const Player* p, int block) const;  // block = BlockIndex ID
 
     bool degradeBuilding(Player* p, AcademicBuilding* ab);  // Sell an improvement
 
     bool mortgageBuilding(Player* p, Building* b);
     bool unmortgageBuilding(Player* p, Building* b);
 
+    // Equivalent to playTurn(p, {die1, die2}).
     void simulateTurn(Player* p, int die1, int die2);
     void handleAuction(Building* b);
+
+    // Chooses how auctions run (Interactive by default).
+    void setAuctionMode(AuctionMode mode);
+
+    // Where proxy maxima come from (bots). Without one, each bidder is asked
+    // once on std::cin. Bids are clamped to the bidder's cash.
+    void setProxyBidSource(std::function<int(const Player*, const Building*)> source);
+
+    // Hands p's decisions to s (nullptr: back to std::cin). Not owned.
+    void setStrategy(const Player* p, const Strategy* s);
+
+    // p's strategy, or nullptr for a human player.
+    const Strategy* getStrategy(const Player* p) const;
+
+    // A whole turn for a computer player: playTurn(p), then the
+    // improvements its strategy asks for. p must have a strategy.
+    void playBotTurn(Player* p);
+
+    // Settles sealed maxima in one pass. Equal maxima go to the earliest
+    // bidder; if nobody bids, the first bidder receives it for $0.
+    static AuctionResult resolveProxyAuction(std::span<const int> maxima, AuctionMode rule);
+    static AuctionResult resolveProxyAuction(const std::vector<int>& maxima, AuctionMode rule);
     void declareBankruptcy(Player* debtor, Player* creditor);
     bool enforcePayment(Player* debtor, int amount, Player* creditor = nullptr);
     bool attemptToRaiseFunds(Player* p, int amountOwed);
+
+    // Non-interactive attemptToRaiseFunds: plans the improvement sales and
+    // mortgages that lose the least rent (see Liquidation) and applies them
+    // as one batch. Returns false, changing nothing, if p cannot cover it.
+    bool raiseFundsAutomatically(Player* p, int amountOwed);
     void printAssets(Player* p);
 
+    // Hash of everything a game's outcome depends on: each square's owner,
+    // improvements and mortgage, and each player's money, position, roll-up
+    // cups, Tims state and bankruptcy (players in token order). Equal games
+    // hash equal on any platform.
+    std::uint64_t stateHash() const;
+
+    // Rebuilds all players' asset totals from current ownership. Call after
+    // setting up ownership/improvements directly (e.g. loading a save).
+    void recalculateAssets();
+
 };
@@ -0,0 +1,82 @@
+// Game-impl.cc (implementation)
+// Module: Game
+// Description:
+//   Implements game ownership and fork(). A fork builds a fresh Board on
+//   the same definition in its own arena, copies the players (into that
+//   arena) and the parent's BoardState by value, re-points the copied owner
+//   table at the copied players, and lets the controller carry over its
+//   own state.
+
+module Game;
+
+import <stdexcept>;
+import Ownership;
+
+Game::Game(const BoardDefinition& definition)
+    : memory{buffer.data(), buffer.size()},
+      board{definition, &memory},
+      players{&memory},
+      controller{&memory} {
+    players.reserve(MaxPlayers);
+    controller.setBoard(&board);
+}
+
+Player* Game::addPlayer(const std::string& name, const std::string& token, int startMoney) {
+    if (static_cast<int>(players.size()) == MaxPlayers) {
+        throw std::length_error("a game has at most 8 players");
+    }
+    players.emplace_back(name, token, startMoney);
+    controller.addPlayer(&players.back());
+    return &players.back();
+}
+
+std::unique_ptr<Game> Game::fork() const {
+    auto copy = std::make_unique<Game>(board.getDefinition());
+
+    // Owners, improvements, mortgages and block counts, then the copied
+    // owner table is pointed at the copied players (same turn order).
+    copy->board.getState() = board.getState();
+    OwnershipTable& owners = copy->board.getOwnership();
+    for (const Player& p : players) {
+        copy->players.push_back(p);
+        owners.replacePlayer(&p, &copy->players.back());
+        copy->controller.addPlayer(&copy->players.back());
+    }
+
+    copy->controller.copyStateFrom(controller);
+    return copy;
+}
+
+Board& Game::getBoard() {
+    return board;
+}
+
+const Board& Game::getBoard() const {
+    return board;
+}
+
+GameController& Game::getController() {
+    return controller;
+}
+
+const GameController& Game::getController() const {
+    return controller;
+}
+
+int Game::playerCount() const {
+    return static_cast<int>(players.size());
+}
+
+Player* Game::getPlayer(int index) {
+    return &players[index];
+}
+
+const Player* Game::getPlayer(int index) const {
+    return &players[index];
+}
+
+std::vector<Player*> Game::getPlayers() {
+    std::vector<Player*> all;
+    for (auto& p : players) all.push_back(&p);
+    return all;
+}
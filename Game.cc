@@ -0,0 +1,88 @@
+// Game.cc (interface)
+// Module: Game
+// Description:
+//   Owns everything one game of Watopoly is made of: its Board (built on a
+//   shared BoardDefinition), its players, and the GameController that
+//   mediates between them. main.cc and simulations create a Game instead of
+//   wiring a Board, Players and a controller together by hand.
+//
+//   fork() produces an independent, fully playable copy of a running game:
+//   board state, players, the turn in progress, auction rules and the RNG
+//   state. The copy costs O(state size) — one BoardState, the players and
+//   a few words of controller state — and shares only the immutable board
+//   definition with its parent, so many forks of one position can be rolled
+//   out side by side (e.g. from a thread pool) without touching each other.
+//
+//   Players live in the Game in turn order. Their addresses are fixed for
+//   the Game's lifetime, so the Player* handed out by addPlayer() stays
+//   valid for the controller, the owner table and callers alike.
+//
+//   Memory: each Game has a monotonic arena (std::pmr) that starts in a
+//   buffer inside the Game object and only falls back to the heap if it
+//   runs out. The board's squares and owner table, the players and their
+//   strings, and the controller's maps are all allocated from it, so
+//   setting up, playing and tearing down a typical game touches the heap
+//   once at most (for the Game itself, when it is heap-allocated). Nothing
+//   is freed piecemeal: destroying the Game releases the arena in one step.
+//
+// Related Modules:
+//   - Board, BoardState (the board and its per-game state)
+//   - Player (copied by value when forking)
+//   - GameController (runs the game; copyStateFrom() carries its state over)
+
+export module Game;
+
+import <array>;
+import <cstddef>;
+import <memory>;
+import <memory_resource>;
+import <string>;
+import <vector>;
+import Player;
+import Board;
+import BoardDefinition;
+import GameController;
+
+export class Game {
+public:
+    static constexpr int MaxPlayers = 8;
+
+    // A new game on the given board (the standard board by default). The
+    // definition is referenced, not copied, and must outlive the game and
+    // all of its forks.
+    explicit Game(const BoardDefinition& definition = standardBoardDefinition());
+
+    Game(const Game&) = delete;
+    Game& operator=(const Game&) = delete;
+
+    // Adds a player in turn order and registers them with the controller.
+    // Throws std::length_error beyond MaxPlayers.
+    Player* addPlayer(const std::string& name, const std::string& token, int startMoney = 1500);
+
+    // An independent copy of this game, RNG state included. The spectator
+    // feed stays with the original; a proxy bid source is copied as is.
+    std::unique_ptr<Game> fork() const;
+
+    Board& getBoard();
+    const Board& getBoard() const;
+    GameController& getController();
+    const GameController& getController() const;
+
+    // Number of players, and the player at a turn-order index.
+    int playerCount() const;
+    Player* getPlayer(int index);
+    const Player* getPlayer(int index) const;
+
+    // Every player in turn order (for display and save files).
+    std::vector<Player*> getPlayers();
+
+private:
+    // Declared first so it outlives everything allocated from it.
+    static constexpr std::size_t InlineArenaBytes = 8192;
+    std::array<std::byte, InlineArenaBytes> buffer;
+    std::pmr::monotonic_buffer_resource memory;
+
+    Board board;
+    std::pmr::vector<Player> players;  // reserved for MaxPlayers: never reallocates
+    GameController controller;
+};
@@ -2,9 +2,8 @@
 // Module: Gym
 // Description:
 //   Implements the onLand behavior for Gym squares in Watopoly.
-//   Rent depends on the number of Gyms owned by the current owner:
-//     - 1 Gym  →  4x dice roll
-//     - 2 Gyms → 10x dice roll
+//   Rent depends on the number of Gyms owned by the current owner: the
+//   dice total times that count's multiplier.
 //
 //   GameController may later provide dice rolling and rent charging logic.
 //   This implementation simply prints expected behavior.
@@ -14,10 +13,15 @@ module Gym;
 import <iostream>;
 import LandAction;
 
-// Constructs a Gym with name, board position, and purchase price.
+// Constructs the Gym at a position of a board definition.
 // Delegates base initialization to Building.
-Gym::Gym(std::string name, int position, int price)
-    : Building{name, position, price} {}
+Gym::Gym(const BoardDefinition& layout, int position)
+    : Building{layout, position} {}
+
+int Gym::getMultiplier(int owned) const {
+    if (owned < 1 || owned > 2) return 0;
+    return layout->gymMultiplier[owned];
+}
 
 // Called when a player lands on a Gym square.
 // If unowned, gives purchase option.
@@ -26,12 +30,13 @@ Gym::Gym(std::string name, int position, int price)
 LandAction Gym::onLand(Player* p) {
     std::cout << p->getName() << " landed on Gym " << getName() << ".\n";
 
-    if (getOwnerToken() == "BANK") {
+    Player* owner = getOwner();
+    if (!owner) {
         std::cout << "You may buy this for $" << getPrice() << ".\n";
         return LandAction::PromptPurchase;
-    } else if (getOwnerToken() != p->getToken()) {
-        std::cout << "Rent is 4x or 10x dice roll depending on # gyms owned by "
-                  << getOwnerToken() << ".\n";
+    } else if (owner != p) {
+        std::cout << "Rent is a multiple of the dice roll depending on # gyms owned by "
+                  << owner->getToken() << ".\n";
         return LandAction::PayRent;
     } else {
         std::cout << "You own this.\n";
@@ -40,7 +45,7 @@ LandAction Gym::onLand(Player* p) {
 }
 
 int Gym::calculateRent(int context) const {
-    // context = numGymsOwned * diceTotal, pre-computed by GameController
+    // context = multiplier * diceTotal, pre-computed by GameController
     return context;
 }
 
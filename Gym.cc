@@ -2,8 +2,9 @@
 // Module: Gym
 // Description:
 //   Represents an ownable Gym square in Watopoly (e.g., "PAC", "CIF").
-//   Rent on Gyms is calculated based on a dice roll and the number of
-//   Gyms owned by the same player (4x or 10x dice sum).
+//   Rent on Gyms is the dice total times a multiplier that depends on
+//   the number of Gyms owned by the same player (board definition;
+//   1x / 2x on the standard board).
 //
 //   Gym inherits from Building and overrides the onLand behavior.
 //   Actual dice rolling and rent logic may be delegated to GameController.
@@ -18,17 +19,20 @@ export module Gym;
 import LandAction;
 import Building;
 import Player;
-import <string>;
+import BoardDefinition;
 
 export class Gym : public Building {
 public:
-    // Constructs a Gym with name, board position, and price.
-    Gym(std::string name, int position, int price);
+    // Constructs the Gym at a position of a board definition.
+    Gym(const BoardDefinition& layout, int position);
+
+    // Dice multiplier when the owner holds `owned` gyms.
+    int getMultiplier(int owned) const;
 
     // Called when a player lands on the Gym.
     // Future: GameController may determine dice outcome and apply rent.
     LandAction onLand(Player* p) override;
 
-     // Gym rent depends on dice roll * multiplier (based on how many gyms owned)
+    // Gym rent depends on dice roll * multiplier (based on how many gyms owned)
     int calculateRent(int context) const override;
 };
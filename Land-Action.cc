@@ -34,5 +34,6 @@ export enum class LandAction {
     PayCoopFee,
     Teleport,
     NEEDLESHALL,
+    SLC,             ///< Landed on SLC → controller draws a card (see SLC::draw)
     GoToTims
 };
@@ -0,0 +1,223 @@
+// Liquidation-impl.cc (implementation)
+// Module: Liquidation
+// Description:
+//   Builds the option groups for a player's holdings and solves the
+//   multiple-choice knapsack. Cash is measured in units of the gcd of all
+//   option values and capped at the deficit, so the table stays small
+//   (a few hundred cells for realistic debts).
+
+module Liquidation;
+
+import <algorithm>;
+import <limits>;
+import <numeric>;
+import <string>;
+import AcademicBuilding;
+import Residence;
+import Gym;
+import Square;
+import PropertySet;
+import BlockIndex;
+
+namespace {
+
+// One way of handling a group; option 0 of every group is "leave it alone".
+struct Option {
+    int cash = 0;
+    int loss = 0;
+    std::vector<LiquidationAction> actions;
+};
+
+using Group = std::vector<Option>;
+
+// All the ways to liquidate a block. Improvement sales are free-form; once
+// every owned building in the block is stripped (and nobody else has
+// improvements in it) any subset of the unmortgaged buildings may also be
+// mortgaged — the same rules mortgageBuilding enforces.
+Group blockOptions(const std::vector<AcademicBuilding*>& owned, bool monopoly, bool othersImproved) {
+    Group group;
+    std::vector<int> sold(owned.size(), 0);
+
+    auto makeOption = [&]() {
+        Option opt;
+        for (std::size_t i = 0; i < owned.size(); ++i) {
+            auto* ab = owned[i];
+            int level = ab->getImprovementCount();
+            opt.cash += sold[i] * (ab->getImprovementCost() / 2);
+            opt.loss += ab->rentAtLevel(level, monopoly) - ab->rentAtLevel(level - sold[i], monopoly);
+            for (int k = 0; k < sold[i]; ++k) {
+                opt.actions.push_back({LiquidationStep::SellImprovement, ab});
+            }
+        }
+        return opt;
+    };
+
+    // Every combination of improvement sales (odometer over sold[]).
+    while (true) {
+        group.push_back(makeOption());
+        std::size_t i = 0;
+        while (i < owned.size() && sold[i] == owned[i]->getImprovementCount()) sold[i++] = 0;
+        if (i == owned.size()) break;
+        ++sold[i];
+    }
+
+    if (othersImproved) return group;
+
+    std::vector<AcademicBuilding*> candidates;
+    for (std::size_t i = 0; i < owned.size(); ++i) {
+        sold[i] = owned[i]->getImprovementCount();
+        if (!owned[i]->isMortgaged()) candidates.push_back(owned[i]);
+    }
+    const Option stripped = makeOption();
+
+    for (unsigned mask = 1; mask < (1u << candidates.size()); ++mask) {
+        Option opt = stripped;
+        for (std::size_t i = 0; i < candidates.size(); ++i) {
+            if (!(mask & (1u << i))) continue;
+            opt.cash += candidates[i]->getPrice() / 2;
+            opt.loss += candidates[i]->rentAtLevel(0, monopoly);
+            opt.actions.push_back({LiquidationStep::Mortgage, candidates[i]});
+        }
+        group.push_back(std::move(opt));
+    }
+    return group;
+}
+
+// A residence or gym: keep it, or mortgage it and lose its rent.
+Group mortgageOptions(Building* b, int rentValue) {
+    Group group(1);
+    group.push_back({b->getPrice() / 2, rentValue, {{LiquidationStep::Mortgage, b}}});
+    return group;
+}
+
+}  // namespace
+
+LiquidationPlan planLiquidation(const Player* p, const Board& board, int deficit) {
+    LiquidationPlan plan;
+    if (deficit <= 0) {
+        plan.feasible = true;
+        return plan;
+    }
+
+    // === Build one option group per block / standalone property ===
+    std::vector<Group> groups;
+    const BlockIndex& blocks = board.getBlocks();
+    PropertySet blocksDone;  // one bit per block ID already grouped
+    const PropertySet& props = p->getProperties();
+    int residences = 0, gyms = 0;
+    for (int pos : props) {
+        Square* sq = board.getSquare(pos);
+        if (dynamic_cast<Residence*>(sq)) ++residences;
+        if (dynamic_cast<Gym*>(sq)) ++gyms;
+    }
+
+    for (int pos : props) {
+        auto* b = dynamic_cast<Building*>(board.getSquare(pos));
+        if (!b) continue;
+
+        if (auto* ab = dynamic_cast<AcademicBuilding*>(b)) {
+            const int block = ab->getBlockId();
+            if (blocksDone.contains(block)) continue;
+            blocksDone.insert(block);
+
+            std::vector<AcademicBuilding*> owned;
+            int ownedImprovements = 0;
+            for (int i : props & blocks.members(block)) {
+                owned.push_back(static_cast<AcademicBuilding*>(board.getSquare(i)));
+                ownedImprovements += owned.back()->getImprovementCount();
+            }
+            bool monopoly = blocks.ownsAll(props, block);
+            bool othersImproved = blocks.improvements(block) > ownedImprovements;
+            groups.push_back(blockOptions(owned, monopoly, othersImproved));
+        } else if (!b->isMortgaged()) {
+            auto* res = dynamic_cast<Residence*>(b);
+            int rentValue = res ? res->calculateRent(residences)
+                                : static_cast<Gym*>(b)->getMultiplier(gyms) * 7;
+            groups.push_back(mortgageOptions(b, rentValue));
+        }
+    }
+
+    // === Scale cash to gcd units and check the deficit is reachable ===
+    int unit = 0;
+    long long maxCash = 0;
+    for (const auto& g : groups) {
+        int best = 0;
+        for (const auto& opt : g) {
+            if (opt.cash > 0) unit = std::gcd(unit, opt.cash);
+            best = std::max(best, opt.cash);
+        }
+        maxCash += best;
+    }
+    if (unit == 0 || maxCash < deficit) return plan;
+
+    const int target = (deficit + unit - 1) / unit;
+
+    // === Multiple-choice knapsack: cost[c] = cheapest way to raise c units
+    // (capped at target). Ties prefer fewer actions. ===
+    struct Cost {
+        long long loss;
+        int actions;
+        bool operator<(const Cost& o) const {
+            return loss != o.loss ? loss < o.loss : actions < o.actions;
+        }
+    };
+    struct Back {
+        int prev = -1;
+        int option = -1;
+    };
+    const Cost unreachable{std::numeric_limits<long long>::max(), 0};
+
+    std::vector<Cost> cost(target + 1, unreachable);
+    std::vector<std::vector<Back>> back(groups.size(), std::vector<Back>(target + 1));
+    cost[0] = {0, 0};
+
+    for (std::size_t g = 0; g < groups.size(); ++g) {
+        std::vector<Cost> next(target + 1, unreachable);
+        for (int c = 0; c <= target; ++c) {
+            if (cost[c].loss == unreachable.loss) continue;
+            for (std::size_t o = 0; o < groups[g].size(); ++o) {
+                const Option& opt = groups[g][o];
+                int nc = std::min(target, c + opt.cash / unit);
+                Cost candidate{cost[c].loss + opt.loss,
+                               cost[c].actions + static_cast<int>(opt.actions.size())};
+                if (candidate < next[nc]) {
+                    next[nc] = candidate;
+                    back[g][nc] = {c, static_cast<int>(o)};
+                }
+            }
+        }
+        cost = std::move(next);
+    }
+
+    // === Walk back through the choices ===
+    int c = target;
+    for (std::size_t g = groups.size(); g-- > 0;) {
+        const Option& opt = groups[g][back[g][c].option];
+        plan.cashRaised += opt.cash;
+        plan.rentLost += opt.loss;
+        plan.actions.insert(plan.actions.end(), opt.actions.begin(), opt.actions.end());
+        c = back[g][c].prev;
+    }
+
+    // Sales must happen before the mortgages they make legal.
+    std::stable_partition(plan.actions.begin(), plan.actions.end(), [](const LiquidationAction& a) {
+        return a.step == LiquidationStep::SellImprovement;
+    });
+    plan.feasible = true;
+    return plan;
+}
+
+// Improvements can only stand on a whole block, so nobody else's ever
+// blocks p's mortgages and every option group's largest option is "all of it".
+int liquidationValue(const Player* p, const Board& board) {
+    int value = 0;
+    for (int pos : p->getProperties()) {
+        auto* b = dynamic_cast<Building*>(board.getSquare(pos));
+        if (!b) continue;
+        if (auto* ab = dynamic_cast<AcademicBuilding*>(b)) {
+            value += ab->getImprovementCount() * (ab->getImprovementCost() / 2);
+        }
+        if (!b->isMortgaged()) value += b->getPrice() / 2;
+    }
+    return value;
+}
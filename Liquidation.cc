@@ -0,0 +1,55 @@
+// Liquidation.cc (interface)
+// Module: Liquidation
+// Description:
+//   Automatic debt resolution. Given a player and how much cash they are
+//   short, planLiquidation() picks the improvement sales and mortgages that
+//   raise at least that much while giving up the least future rent.
+//
+//   The search is exact: each monopoly block (and each residence/gym) is a
+//   group of mutually exclusive options that respect the block rules
+//   (a property can only be mortgaged once its whole block is unimproved),
+//   and a multiple-choice knapsack DP over cash raised picks one option per
+//   group. The result is a flat list of actions that GameController applies
+//   in one batch (improvement sales first, then mortgages).
+//
+//   Rent value of a square is what it would charge a visitor right now:
+//     - Academic: rent at its improvement level (doubled when unimproved
+//       in a monopoly)
+//     - Residence: rent for the number of residences the owner holds
+//     - Gym: the multiplier for gyms owned * 7 (expected two-dice total)
+//
+// Related Modules:
+//   - GameController (applies a plan via degradeBuilding/mortgageBuilding)
+//   - Board (source of squares and block membership)
+
+export module Liquidation;
+
+import <vector>;
+import Player;
+import Board;
+import Building;
+
+export enum class LiquidationStep {
+    SellImprovement,  // degradeBuilding once
+    Mortgage          // mortgageBuilding
+};
+
+export struct LiquidationAction {
+    LiquidationStep step;
+    Building* building;
+};
+
+export struct LiquidationPlan {
+    bool feasible = false;   // false: even selling everything is not enough
+    int cashRaised = 0;      // total cash the actions bring in
+    int rentLost = 0;        // rent value given up (the minimised quantity)
+    std::vector<LiquidationAction> actions;  // sales first, then mortgages
+};
+
+// Plans how p can raise at least `deficit` dollars. If that is impossible,
+// the returned plan is infeasible and lists nothing.
+export LiquidationPlan planLiquidation(const Player* p, const Board& board, int deficit);
+
+// The most p could raise: every improvement sold and every building
+// mortgaged (a deficit above this has no feasible plan).
+export int liquidationValue(const Player* p, const Board& board);
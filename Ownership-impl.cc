@@ -0,0 +1,43 @@
+// Ownership-impl.cc (implementation)
+// Module: Ownership
+// Description:
+//   Implements the authoritative owner table. setOwner() is the only code
+//   that edits a Player's PropertySet.
+
+module Ownership;
+
+void OwnershipTable::addPlayer(Player* p) {
+    for (auto* existing : players) {
+        if (existing == p) return;
+    }
+    players.push_back(p);
+}
+
+Player* OwnershipTable::findPlayer(const std::string& token) const {
+    for (auto* p : players) {
+        if (p->getToken() == token) return p;
+    }
+    return nullptr;
+}
+
+Player* OwnershipTable::ownerOf(int position) const {
+    return owners[position];
+}
+
+void OwnershipTable::setOwner(int position, Player* p) {
+    Player* old = owners[position];
+    if (old == p) return;
+
+    if (old) old->removeProperty(position);
+    owners[position] = p;
+    if (p) p->addProperty(position);
+}
+
+void OwnershipTable::replacePlayer(const Player* from, Player* to) {
+    for (auto*& owner : owners) {
+        if (owner == from) owner = to;
+    }
+    for (auto*& p : players) {
+        if (p == from) p = to;
+    }
+}
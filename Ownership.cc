@@ -0,0 +1,55 @@
+// Ownership.cc (interface)
+// Module: Ownership
+// Description:
+//   Single source of truth for who owns which square.
+//
+//   OwnershipTable holds one authoritative owner slot per board position
+//   (nullptr = Bank). Each Player's PropertySet is a 40-bit view derived
+//   from it: setOwner() is the only place that changes ownership, and it
+//   updates the previous and new owner's bitsets in the same step, so the
+//   two can never drift apart.
+//
+// Related Modules:
+//   - PropertySet (the per-player bitset)
+//   - Board (owns the table for its squares)
+//   - Building (reads/writes its owner through the table)
+//   - Player (exposes its derived PropertySet via getProperties())
+
+export module Ownership;
+
+import <array>;
+import <memory_resource>;
+import <string>;
+import <vector>;
+import Player;
+
+export class OwnershipTable {
+public:
+    static constexpr int Squares = 40;
+
+    // The registered-player list is stored with memory (a game's arena).
+    explicit OwnershipTable(std::pmr::memory_resource* memory = std::pmr::get_default_resource())
+        : players{memory} {}
+
+    // Makes p resolvable by token (for setOwnerToken-style lookups).
+    void addPlayer(Player* p);
+
+    // Returns the registered player with this token, or nullptr
+    // ("BANK", "" and unknown tokens all mean the Bank).
+    Player* findPlayer(const std::string& token) const;
+
+    // Returns the owner of the square at position, or nullptr for the Bank.
+    Player* ownerOf(int position) const;
+
+    // Changes the owner of a square and updates both players' bitsets.
+    void setOwner(int position, Player* p);
+
+    // Points every reference to `from` at `to` instead, leaving the
+    // bitsets alone. Used after copying a table for a forked game, whose
+    // copied players already carry the same bitsets.
+    void replacePlayer(const Player* from, Player* to);
+
+private:
+    std::array<Player*, Squares> owners{};
+    std::pmr::vector<Player*> players;
+};
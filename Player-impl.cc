@@ -5,7 +5,7 @@
 //   human-controlled player in Watopoly.
 //
 //   This includes tracking their name, token, balance, and buildings owned
-//   (by name only to avoid circular dependencies with Building).
+//   (by board position only to avoid circular dependencies with Building).
 //
 //   Used by: GameController (to manage player interactions),
 //            Square subclasses (to check ownership or apply effects)
@@ -13,20 +13,27 @@
 module Player;
 
 import <iostream>;
-import <algorithm>;  // Needed for std::find and std::remove
 
 // Constructs a new player with name, token, and optional starting balance.
-Player::Player(std::string name, std::string token, int startMoney)
-    : name{name}, token{token}, money{startMoney} {}
+Player::Player(std::string_view name, std::string_view token, int startMoney,
+               const allocator_type& alloc)
+    : name{name, alloc}, token{token, alloc}, money{startMoney} {}
+
+Player::Player(const Player& other, const allocator_type& alloc)
+    : name{other.name, alloc}, token{other.token, alloc}, money{other.money},
+      ownedBuildings{other.ownedBuildings}, position{other.position},
+      inTims{other.inTims}, bankrupt{other.bankrupt}, timsTurns{other.timsTurns},
+      rollUpCups{other.rollUpCups}, propertyValue{other.propertyValue},
+      improvementValue{other.improvementValue}, mortgageLiability{other.mortgageLiability} {}
 
 // Returns the player's name.
 std::string Player::getName() const {
-    return name;
+    return std::string{name};
 }
 
 // Returns the player's token, used to identify ownership on buildings.
 std::string Player::getToken() const {
-    return token;
+    return std::string{token};
 }
 
 // Returns the player's current money balance.
@@ -48,25 +55,19 @@ void Player::receive(int amount) {
     std::cout << name << " received $" << amount << ". New total: $" << money << "\n";
 }
 
-// Adds a building to the player's list of owned properties.
-// Uses building name string to avoid direct Building reference.
-void Player::addProperty(const std::string& buildingName) {
-    ownedBuildings.push_back(buildingName);
+// Marks a board position as owned (called by OwnershipTable).
+void Player::addProperty(int position) {
+    ownedBuildings.insert(position);
 }
 
-// Removes a building from the player's owned list if it exists.
-void Player::removeProperty(const std::string& buildingName) {
-    ownedBuildings.erase(
-        std::remove(ownedBuildings.begin(), ownedBuildings.end(), buildingName),
-        ownedBuildings.end()
-    );
+// Clears a board position from the owned set (called by OwnershipTable).
+void Player::removeProperty(int position) {
+    ownedBuildings.erase(position);
 }
 
-// Checks if the player owns a specific building by name.
-bool Player::owns(const std::string& buildingName) const {
-    return std::find(
-        ownedBuildings.begin(), ownedBuildings.end(), buildingName
-    ) != ownedBuildings.end();
+// Checks if the player owns the square at a board position.
+bool Player::owns(int position) const {
+    return ownedBuildings.contains(position);
 }
 
 // Returns the current board position of the player.
@@ -127,6 +128,38 @@ void Player::setRollUpCups(int count) {
     rollUpCups = count;
 }
 
-const std::vector<std::string>& Player::getProperties() const {
+const PropertySet& Player::getProperties() const {
     return ownedBuildings;
 }
+
+int Player::getPropertyValue() const {
+    return propertyValue;
+}
+
+int Player::getImprovementValue() const {
+    return improvementValue;
+}
+
+int Player::getMortgageLiability() const {
+    return mortgageLiability;
+}
+
+int Player::getTotalWorth() const {
+    return money + propertyValue + improvementValue;
+}
+
+int Player::getNetWorth() const {
+    return getTotalWorth() - mortgageLiability;
+}
+
+void Player::adjustAssets(int propertyDelta, int improvementDelta, int liabilityDelta) {
+    propertyValue += propertyDelta;
+    improvementValue += improvementDelta;
+    mortgageLiability += liabilityDelta;
+}
+
+void Player::resetAssets() {
+    propertyValue = 0;
+    improvementValue = 0;
+    mortgageLiability = 0;
+}
@@ -3,10 +3,15 @@
 // Description:
 //   Represents a human-controlled player in the game of Watopoly.
 //   Each player has a unique token, a name, a money balance, and a collection
-//   of buildings they currently own (tracked by building name).
+//   of buildings they currently own (a PropertySet of board positions).
 //
 //   This module is intentionally decoupled from Building to avoid circular
-//   dependencies. Ownership is represented via building name strings.
+//   dependencies. The owned set is derived from the board's OwnershipTable,
+//   which is the only code that changes it.
+//
+//   Player is allocator-aware (std::pmr): inside a Game, the name and token
+//   live in the game's arena, and containers such as std::pmr::vector pass
+//   their memory resource on when they construct or copy a Player.
 //
 // Related Modules:
 //   - GameController (invokes player pay/receive, manages turns and interactions)
@@ -15,28 +20,46 @@
 
 export module Player;
 
+import <memory_resource>;
 import <string>;
+import <string_view>;
 import <vector>;
 import <ctime>;
 import <set>;
+import PropertySet;
 
 
 export class Player {
 private:
-    std::string name;                         // Player's name (e.g., "Vyomm")
-    std::string token;                        // Unique identifier (e.g., "V")
+    std::pmr::string name;                    // Player's name (e.g., "Vyomm")
+    std::pmr::string token;                   // Unique identifier (e.g., "V")
     int money;                                // Player's current balance
-    std::vector<std::string> ownedBuildings;  // List of names of owned properties
+    PropertySet ownedBuildings;               // Board positions of owned properties
     int position = 0; // Default starting position
     bool inTims = false;
     bool bankrupt = false;
     int timsTurns = 0;
     int rollUpCups = 0;  // 🥤 "Get Out of Jail Free" cards
 
+    // Running asset totals (kept in step by GameController, see adjustAssets)
+    int propertyValue = 0;      // Sum of purchase prices of owned buildings
+    int improvementValue = 0;   // Sum of improvement costs on owned buildings
+    int mortgageLiability = 0;  // Cost to unmortgage everything currently mortgaged
+
 
 public:
-    // Constructs a player with a given name, token, and optional starting money.
-    Player(std::string name, std::string token, int startMoney = 1500);
+    using allocator_type = std::pmr::polymorphic_allocator<>;
+
+    // Constructs a player with a given name, token, and optional starting
+    // money. The strings are stored with alloc (the default resource unless
+    // given one).
+    Player(std::string_view name, std::string_view token, int startMoney = 1500,
+           const allocator_type& alloc = {});
+
+    // Copies other, storing the strings with alloc (used by pmr containers).
+    Player(const Player& other, const allocator_type& alloc);
+    Player(const Player&) = default;
+    Player& operator=(const Player&) = default;
 
     // Returns the player's name.
     std::string getName() const;
@@ -53,14 +76,13 @@ public:
     // Adds money to the player's balance.
     void receive(int amount);
 
-    // Adds a building (by name) to the player's owned list.
-    void addProperty(const std::string& buildingName);
-
-    // Removes a building (by name) from the player's owned list.
-    void removeProperty(const std::string& buildingName);
+    // Adds/removes a board position in the owned set. Only OwnershipTable
+    // calls these; everything else changes ownership through the table.
+    void addProperty(int position);
+    void removeProperty(int position);
 
-    // Checks whether the player owns a given building.
-    bool owns(const std::string& buildingName) const;
+    // Checks whether the player owns the square at a board position.
+    bool owns(int position) const;
 
     // Returns the current board position of the player.
     void move(int steps);
@@ -95,6 +117,25 @@ public:
 
     void setRollUpCups(int count);
 
-    const std::vector<std::string>& getProperties() const;
+    // Positions of every owned property (iterate, count or mask it).
+    const PropertySet& getProperties() const;
+
+    // O(1) asset totals.
+    int getPropertyValue() const;
+    int getImprovementValue() const;
+    int getMortgageLiability() const;
+
+    // Tuition's "total worth": cash + building prices + improvement costs.
+    int getTotalWorth() const;
+
+    // Total worth minus what it would cost to lift every mortgage.
+    int getNetWorth() const;
+
+    // Applies a change to the running totals. Called by GameController on
+    // every ownership, improvement and mortgage change.
+    void adjustAssets(int propertyDelta, int improvementDelta, int liabilityDelta);
+
+    // Zeroes the running totals (before GameController rebuilds them).
+    void resetAssets();
 
 };
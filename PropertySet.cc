@@ -0,0 +1,53 @@
+// PropertySet.cc (interface)
+// Module: PropertySet
+// Description:
+//   A set of board positions (0–39) packed into one 64-bit word.
+//   Used as each Player's view of what they own, and for board-wide masks
+//   such as "all residences" or "every square in the Math block".
+//
+//   Membership is a bit test, size() is a popcount, and iteration walks the
+//   set bits lowest-first with count-trailing-zeros, so none of these touch
+//   strings or allocate.
+//
+// Related Modules:
+//   - Ownership (derives each player's PropertySet from the owner table)
+//   - Player, Board, GameController (query ownership through it)
+
+export module PropertySet;
+
+import <bit>;
+import <cstdint>;
+
+export class PropertySet {
+private:
+    std::uint64_t bits = 0;
+
+public:
+    // Walks set positions in increasing order.
+    class iterator {
+        std::uint64_t rest;
+    public:
+        constexpr explicit iterator(std::uint64_t rest) : rest{rest} {}
+        constexpr int operator*() const { return std::countr_zero(rest); }
+        constexpr iterator& operator++() { rest &= rest - 1; return *this; }
+        constexpr bool operator==(const iterator& other) const { return rest == other.rest; }
+    };
+
+    constexpr PropertySet() = default;
+    constexpr explicit PropertySet(std::uint64_t bits) : bits{bits} {}
+
+    constexpr bool contains(int position) const { return (bits >> position) & 1u; }
+    constexpr void insert(int position) { bits |= std::uint64_t{1} << position; }
+    constexpr void erase(int position) { bits &= ~(std::uint64_t{1} << position); }
+
+    constexpr int size() const { return std::popcount(bits); }
+    constexpr bool empty() const { return bits == 0; }
+    constexpr std::uint64_t raw() const { return bits; }
+
+    constexpr iterator begin() const { return iterator{bits}; }
+    constexpr iterator end() const { return iterator{0}; }
+
+    constexpr PropertySet operator&(PropertySet other) const { return PropertySet{bits & other.bits}; }
+    constexpr PropertySet operator|(PropertySet other) const { return PropertySet{bits | other.bits}; }
+    constexpr bool operator==(const PropertySet& other) const = default;
+};
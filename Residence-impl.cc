@@ -4,11 +4,8 @@
 //   Implements the onLand behavior for Residence squares in Watopoly.
 //   Residences include MKV, REV, V1, and UWP.
 //
-//   Rent depends on the number of residences the owner controls:
-//     - 1:  $25
-//     - 2:  $50
-//     - 3: $100
-//     - 4: $200
+//   Rent depends on the number of residences the owner controls, looked
+//   up in the board definition's residence rent table.
 //
 //   Actual rent charging logic will be handled later via GameController.
 
@@ -17,20 +14,21 @@ module Residence;
 import <iostream>;
 import LandAction;
 
-// Constructs a Residence square with name, board index, and purchase price.
-Residence::Residence(std::string name, int position, int price)
-    : Building{name, position, price} {}
+// Constructs the Residence square at a position of a board definition.
+Residence::Residence(const BoardDefinition& layout, int position)
+    : Building{layout, position} {}
 
 // Called when a player lands on a Residence square.
 // Describes rent conditions or purchase options based on ownership.
 LandAction Residence::onLand(Player* p) {
     std::cout << p->getName() << " landed on Residence " << getName() << ".\n";
 
-    if (getOwnerToken() == "BANK") {
+    Player* owner = getOwner();
+    if (!owner) {
         std::cout << "You may buy this for $" << getPrice() << ".\n";
         return LandAction::PromptPurchase;
-    } else if (getOwnerToken() != p->getToken()) {
-        std::cout << "Rent is based on how many residences " << getOwnerToken() << " owns.\n";
+    } else if (owner != p) {
+        std::cout << "Rent is based on how many residences " << owner->getToken() << " owns.\n";
         return LandAction::PayRent;
     } else {
         std::cout << "You own this.\n";
@@ -39,11 +37,6 @@ LandAction Residence::onLand(Player* p) {
 }
 
 int Residence::calculateRent(int numOwned) const {
-    switch (numOwned) {
-        case 1: return 25;
-        case 2: return 50;
-        case 3: return 100;
-        case 4: return 200;
-        default: return 0;
-    }
+    if (numOwned < 1 || numOwned > 4) return 0;
+    return layout->residenceRent[numOwned];
 }
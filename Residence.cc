@@ -2,11 +2,9 @@
 // Module: Residence
 // Description:
 //   Represents a residence property in Watopoly (e.g., MKV, REV, V1, UWP).
-//   Rent is based on how many residences the owner controls:
-//     - 1 owned:  $25
-//     - 2 owned:  $50
-//     - 3 owned: $100
-//     - 4 owned: $200
+//   Rent is based on how many residences the owner controls, from the
+//   board definition's residence rent table (standard board: $25, $50,
+//   $100, $200 for 1-4 owned).
 //
 //   Ownership and rent logic will eventually be handled by GameController,
 //   but basic onLand behavior is overridden here.
@@ -21,12 +19,12 @@ export module Residence;
 import LandAction;
 import Building;
 import Player;
-import <string>;
+import BoardDefinition;
 
 export class Residence : public Building {
 public:
-    // Constructs a Residence with name, position on board, and purchase price.
-    Residence(std::string name, int position, int price);
+    // Constructs the Residence at a position of a board definition.
+    Residence(const BoardDefinition& layout, int position);
 
     // Defines behavior when a player lands on this square.
     // Rent is printed based on owner status (actual rent logic handled elsewhere).
@@ -0,0 +1,294 @@
+// Risk-Map-impl.cc (implementation)
+// Module: RiskMap
+// Description:
+//   The walk over a turn's game tree. The bills that depend only on the
+//   board (each square's rent, or a gym's multiplier to apply to the
+//   dice) are looked up once, so the walk itself is arithmetic on a small
+//   Path value copied into every branch.
+
+module RiskMap;
+
+import <algorithm>;
+import <iomanip>;
+import <string>;
+import AcademicBuilding;
+import Building;
+import Gym;
+import Liquidation;
+import Residence;
+
+namespace {
+
+constexpr int TimsSquare = 10;
+constexpr int TimsFine = 50;
+
+// Where one branch of the turn stands.
+struct Path {
+    double chance = 1;
+    int position = 0;
+    int money = 0;
+    int reserve = 0;           // what liquidation can still raise
+    int delta = 0;             // received minus paid so far
+    int doublesStreak = 0;
+    bool extraTurnAllowed = true;
+    bool shortfall = false;
+};
+
+class TurnWalk {
+public:
+    TurnWalk(const GameController& controller, const Board& board, const Player& player, RiskReport& report)
+        : definition{board.getDefinition()}, assets{player.getTotalWorth() - player.getMoney()}, report{report} {
+        for (int pos = 0; pos < BoardDefinition::Squares; ++pos) {
+            auto* b = dynamic_cast<Building*>(board.getSquare(pos));
+            const Player* owner = b ? b->getOwner() : nullptr;
+            if (!owner || owner == &player || b->isMortgaged() || owner->isInTims()) continue;
+
+            if (dynamic_cast<Residence*>(b)) {
+                rent[pos] = b->calculateRent(controller.getResidenceCount(owner->getToken()));
+            } else if (auto* gym = dynamic_cast<Gym*>(b)) {
+                gymMultiplier[pos] = gym->getMultiplier(controller.getGymCount(owner->getToken()));
+            } else if (auto* ab = dynamic_cast<AcademicBuilding*>(b)) {
+                bool doubled = controller.hasMonopoly(owner, ab->getBlockId()) && ab->getImprovementCount() == 0;
+                rent[pos] = b->calculateRent(doubled ? 1 : 0);
+            }
+        }
+    }
+
+    // One roll: doubles count towards the third that sends the player to
+    // the Tims line, and otherwise earn another roll after the landing.
+    void roll(const Path& from) {
+        for (int d1 = 1; d1 <= 6; ++d1) {
+            for (int d2 = 1; d2 <= 6; ++d2) {
+                Path path = from;
+                path.chance /= 36;
+                if (d1 != d2) {
+                    path.doublesStreak = 0;
+                } else if (++path.doublesStreak == 3) {
+                    sendToTims(path);
+                    continue;
+                }
+                move(path, d1, d2);
+            }
+        }
+    }
+
+    // A roll for doubles from the Tims line: doubles leave with no extra
+    // roll, the third miss pays the fine and moves anyway, any other miss
+    // ends the turn where it is.
+    void rollForDoubles(const Path& from, int timsTurns) {
+        for (int d1 = 1; d1 <= 6; ++d1) {
+            for (int d2 = 1; d2 <= 6; ++d2) {
+                Path path = from;
+                path.chance /= 36;
+                path.extraTurnAllowed = false;
+                if (d1 != d2 && timsTurns < 2) {
+                    finish(path);
+                    continue;
+                }
+                if (d1 != d2 && !pay(path, TimsFine)) continue;
+                move(path, d1, d2);
+            }
+        }
+    }
+
+    bool pay(Path& path, int amount) {
+        SquareRisk& square = report.squares[path.position];
+        square.expectedPaid += path.chance * amount;
+        path.delta -= amount;
+        if (path.money >= amount) {
+            path.money -= amount;
+            return true;
+        }
+        path.shortfall = true;
+        const int deficit = amount - path.money;
+        if (deficit > path.reserve) {
+            square.bankruptcy += path.chance;
+            report.bankruptcyProbability += path.chance;
+            finish(path);
+            return false;
+        }
+        path.reserve -= deficit;
+        path.money = 0;
+        return true;
+    }
+
+private:
+    const BoardDefinition& definition;
+    const int assets;                  // total worth besides cash
+    RiskReport& report;
+    std::array<int, BoardDefinition::Squares> rent{};
+    std::array<int, BoardDefinition::Squares> gymMultiplier{};
+
+    void receive(Path& path, int amount) {
+        path.money += amount;
+        path.delta += amount;
+    }
+
+    // Player::move, then OSAP for passing it.
+    void move(Path& path, int d1, int d2) {
+        const int from = path.position;
+        path.position = (from + d1 + d2) % 40;
+        if (path.position < from && path.position != 0) receive(path, 200);
+        land(path, d1, d2);
+    }
+
+    void land(Path& path, int d1, int d2) {
+        const int pos = path.position;
+        report.squares[pos].landing += path.chance;
+        switch (definition.squares[pos].kind) {
+            case SquareKind::CollectOSAP:
+                receive(path, 200);
+                break;
+            case SquareKind::Academic:
+            case SquareKind::Residence:
+            case SquareKind::Gym: {
+                const int due = rent[pos] + gymMultiplier[pos] * (d1 + d2);
+                if (due > 0 && !pay(path, due)) return;
+                break;
+            }
+            case SquareKind::Tuition:
+                if (!pay(path, std::min(300, (path.money + assets) / 10))) return;
+                break;
+            case SquareKind::CoopFee:
+                if (!pay(path, 150)) return;
+                break;
+            case SquareKind::GoToTims:
+                sendToTims(path);
+                return;
+            case SquareKind::SLC:
+                drawSlc(path, d1, d2);
+                return;
+            case SquareKind::NeedlesHall:
+                drawNeedlesHall(path, d1, d2);
+                return;
+            default:
+                break;
+        }
+        again(path, d1, d2);
+    }
+
+    // A card moves the player without resolving where they end up (as
+    // SLC::draw does), so only the Tims card ends the turn.
+    void drawSlc(const Path& from, int d1, int d2) {
+        const ChanceTable<SlcOutcome>& cards = definition.slc;
+        for (int i = 0; i < cards.size(); ++i) {
+            Path path = from;
+            path.chance *= static_cast<double>(cards.weight(i)) / cards.totalWeight();
+            const SlcOutcome& card = cards.outcome(i);
+            if (card.effect == SlcEffect::GoToTims) {
+                sendToTims(path);
+                continue;
+            }
+            path.position = card.effect == SlcEffect::CollectOSAP ? 0 : (path.position + card.move) % 40;
+            again(path, d1, d2);
+        }
+    }
+
+    void drawNeedlesHall(const Path& from, int d1, int d2) {
+        const ChanceTable<int>& amounts = definition.needlesHall;
+        for (int i = 0; i < amounts.size(); ++i) {
+            Path path = from;
+            path.chance *= static_cast<double>(amounts.weight(i)) / amounts.totalWeight();
+            const int amount = amounts.outcome(i);
+            if (amount >= 0) {
+                receive(path, amount);
+            } else if (!pay(path, -amount)) {
+                continue;
+            }
+            again(path, d1, d2);
+        }
+    }
+
+    void sendToTims(Path& path) {
+        path.position = TimsSquare;
+        finish(path);
+    }
+
+    void again(const Path& path, int d1, int d2) {
+        if (d1 == d2 && path.extraTurnAllowed) {
+            roll(path);
+        } else {
+            finish(path);
+        }
+    }
+
+    void finish(const Path& path) {
+        report.expectedCashChange += path.chance * path.delta;
+        if (path.shortfall) report.shortfallProbability += path.chance;
+    }
+};
+
+RiskReport walkTurn(const GameController& controller, const Board& board, const Player* p, TimsOption option) {
+    RiskReport report;
+    report.timsOption = option;
+    TurnWalk walk{controller, board, *p, report};
+    Path start;
+    start.position = p->getPosition();
+    start.money = p->getMoney();
+    start.reserve = liquidationValue(p, board);
+
+    switch (option) {
+        case TimsOption::Roll:
+            walk.rollForDoubles(start, p->getTimsTurns());
+            break;
+        case TimsOption::Fine:
+            walk.pay(start, TimsFine);  // only offered with the cash for it
+            walk.roll(start);
+            break;
+        default:
+            walk.roll(start);
+    }
+    return report;
+}
+
+const char* optionName(TimsOption option) {
+    switch (option) {
+        case TimsOption::Cup:  return "use a Roll Up the Rim cup";
+        case TimsOption::Fine: return "pay the $50 fine";
+        case TimsOption::Roll: return "roll for doubles";
+        default:               return "";
+    }
+}
+
+}  // namespace
+
+RiskReport assessTurn(const GameController& controller, const Board& board, const Player* p) {
+    if (!p->isInTims()) return walkTurn(controller, board, p, TimsOption::NotInLine);
+
+    RiskReport best = walkTurn(controller, board, p, TimsOption::Roll);
+    auto consider = [&](TimsOption option) {
+        RiskReport other = walkTurn(controller, board, p, option);
+        if (other.expectedCashChange > best.expectedCashChange ||
+            (other.expectedCashChange == best.expectedCashChange &&
+             other.bankruptcyProbability < best.bankruptcyProbability)) {
+            best = other;
+        }
+    };
+    if (p->getRollUpCups() > 0) consider(TimsOption::Cup);
+    if (p->getMoney() >= TimsFine) consider(TimsOption::Fine);
+    return best;
+}
+
+void printRiskMap(std::ostream& out, const RiskReport& report, const BoardDefinition& definition) {
+    const auto flags = out.flags();
+    const auto precision = out.precision();
+    out << std::fixed << std::setprecision(2);
+    out << "[RISK] Expected cash change: $" << report.expectedCashChange << "\n";
+    out << "[RISK] Chance of having to sell or mortgage: " << 100 * report.shortfallProbability << "%\n";
+    out << "[RISK] Chance of bankruptcy: " << 100 * report.bankruptcyProbability << "%\n";
+    if (report.timsOption != TimsOption::NotInLine) {
+        out << "[RISK] Best way out of the Tims line: " << optionName(report.timsOption) << "\n";
+    }
+
+    out << std::left << std::setw(4) << "Pos" << std::setw(22) << "Square" << std::right << std::setw(9)
+        << "Land %" << std::setw(12) << "Expected $" << std::setw(12) << "Bankrupt %" << "\n";
+    for (int pos = 0; pos < BoardDefinition::Squares; ++pos) {
+        const SquareRisk& square = report.squares[pos];
+        if (square.landing == 0) continue;
+        out << std::left << std::setw(4) << pos << std::setw(22) << definition.squares[pos].name << std::right
+            << std::setw(9) << 100 * square.landing << std::setw(12) << square.expectedPaid << std::setw(12)
+            << 100 * square.bankruptcy << "\n";
+    }
+    out.flags(flags);
+    out.precision(precision);
+}
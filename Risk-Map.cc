@@ -0,0 +1,79 @@
+// Risk-Map.cc (interface)
+// Module: RiskMap
+// Description:
+//   Exact odds for the turn a player is about to take: the expected change
+//   in their cash, the probability that they will have to sell or mortgage
+//   to cover a bill, and the probability that they go bankrupt, together
+//   with a per-square map of where the turn lands and what it pays there.
+//
+//   Nothing is sampled. assessTurn() walks the whole game tree of the
+//   turn: each roll branches on all 36 dice outcomes, each SLC card and
+//   Needles Hall amount on every entry of the board's chance tables (with
+//   probability weight / total weight), and doubles roll again, up to the
+//   third double that sends the player to the Tims line. Bills are the
+//   ones GameController::playTurn would charge right now: rent with
+//   monopoly doubling, residences owned, gym multiplier times the dice,
+//   nothing for mortgaged buildings or owners in the Tims line, Tuition,
+//   the Coop Fee and the Tims fine. Three rolls give at most 36^3 dice
+//   paths, so a whole assessment takes well under a millisecond.
+//
+//   The player's choices are decision nodes, taken the way that is best
+//   for their cash (expectimax):
+//     - Tuition: the cheaper of $300 and 10% of total worth
+//     - starting in the Tims line: a Roll Up the Rim cup, the $50 fine or
+//       a roll for doubles, whichever leaves the most expected cash (the
+//       lower bankruptcy probability on a tie); the report says which
+//     - unowned buildings are not bought: a purchase swaps cash for an
+//       asset, and the player may always decline
+//   A bill the player cannot pay in cash is covered by liquidation as
+//   long as the shortfall is within liquidationValue() (what is left of
+//   it after earlier bills in the same turn, taking each sale to raise
+//   exactly the shortfall); beyond that the player goes bankrupt and the
+//   branch ends.
+//
+//   The dice and the chance tables are treated as exactly uniform and
+//   weighted; the engine's `roll % 6` and `roll % total` on a 31-bit
+//   generator differ from that by under one part in 10^8.
+//
+// Related Modules:
+//   - GameController (rent rules; the turn this reproduces)
+//   - BoardDefinition (square kinds and the SLC / Needles Hall tables)
+//   - Liquidation (how much a shortfall can be covered by)
+
+export module RiskMap;
+
+import <array>;
+import <ostream>;
+import Board;
+import BoardDefinition;
+import GameController;
+import Player;
+
+export struct SquareRisk {
+    double landing = 0;        // probability the turn lands here (before any SLC jump)
+    double expectedPaid = 0;   // expected dollars paid here (probability times bill)
+    double bankruptcy = 0;     // probability the turn ends in bankruptcy here
+};
+
+export enum class TimsOption {
+    NotInLine,
+    Cup,       // use a Roll Up the Rim cup, then roll
+    Fine,      // pay $50, then roll
+    Roll       // roll for doubles
+};
+
+export struct RiskReport {
+    double expectedCashChange = 0;   // received minus paid, a bankrupting bill in full
+    double shortfallProbability = 0; // some bill needs sales or mortgages
+    double bankruptcyProbability = 0;
+    TimsOption timsOption = TimsOption::NotInLine;
+    std::array<SquareRisk, BoardDefinition::Squares> squares{};
+};
+
+// The turn p would take now, from p's position, cash and Tims line state
+// and the current ownership. Changes nothing.
+export RiskReport assessTurn(const GameController& controller, const Board& board, const Player* p);
+
+// The totals, then one row per square the turn can land on: its chance,
+// expected payment and bankruptcy chance (the "risk" command).
+export void printRiskMap(std::ostream& out, const RiskReport& report, const BoardDefinition& definition);
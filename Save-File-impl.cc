@@ -0,0 +1,151 @@
+// Save-File-impl.cc (implementation)
+// Module: SaveFile
+// Description:
+//   The save/load code formerly inlined in main.cc.
+
+module SaveFile;
+
+import <sstream>;
+import <stdexcept>;
+import <string>;
+import Building;
+import AcademicBuilding;
+import Strategy;
+
+void writeSaveFile(std::ostream& out, const std::vector<Player*>& players, const Board& board,
+                   const GameController& controller) {
+    // Players
+    out << players.size() << "\n";
+    for (auto* pl : players) {
+        out << pl->getName() << " "
+            << pl->getToken() << " "
+            << pl->getRollUpCups() << " "
+            << pl->getMoney() << " "
+            << pl->getPosition();
+
+        if (pl->getPosition() == 10 && pl->isInTims()) {
+            out << " 1 " << pl->getTimsTurns();
+        }
+
+        if (const Strategy* s = controller.getStrategy(pl)) {
+            out << " " << s->name();
+        }
+
+        out << "\n";
+    }
+
+    // Buildings
+    for (int i = 0; i < 40; ++i) {
+        auto* building = dynamic_cast<Building*>(board.getSquare(i));
+        if (!building) continue;
+
+        Player* ownerPlayer = building->getOwner();
+        std::string owner = ownerPlayer ? ownerPlayer->getName() : "BANK";
+        int improvements = 0;
+
+        if (building->isMortgaged()) {
+            improvements = -1;
+        } else if (auto* ab = dynamic_cast<AcademicBuilding*>(building)) {
+            improvements = ab->getImprovementCount();
+        }
+
+        out << building->getName() << " " << owner << " " << improvements << "\n";
+    }
+}
+
+std::vector<Player*> readSaveFile(std::istream& in, Game& game) {
+    GameController& controller = game.getController();
+    std::vector<Player*> players;
+
+    int numPlayers = 0;
+    in >> numPlayers;
+    if (numPlayers < 2 || numPlayers > Game::MaxPlayers) {
+        throw std::runtime_error("save file must list 2–8 players");
+    }
+
+    // One line per player, since the Tims fields and strategy are optional
+    std::string line;
+    std::getline(in, line);  // rest of the count's line
+    for (int i = 0; i < numPlayers; ++i) {
+        while (std::getline(in, line) && line.find_first_not_of(" \t\r") == std::string::npos) {}
+        std::istringstream fields(line);
+
+        std::string name;
+        char token;
+        int cups, money, pos;
+        if (!(fields >> name >> token >> cups >> money >> pos) || cups < 0 || pos < 0 || pos >= 40) {
+            throw std::runtime_error("bad player line: \"" + line + "\"");
+        }
+
+        Player* p = game.addPlayer(name, std::string(1, token));
+        p->setRollUpCups(cups);
+        p->setMoney(money);
+        p->moveTo(pos);
+
+        if (pos == 10) {
+            int inTims = 0;
+            if (fields >> inTims && inTims == 1) {
+                int turns;
+                if (!(fields >> turns) || turns < 0 || turns > 2) {
+                    throw std::runtime_error("bad Tims turns for " + name + ": \"" + line + "\"");
+                }
+                p->setInTims(true);
+                for (int j = 0; j < turns; ++j) p->incrementTimsTurn();
+            }
+            fields.clear();  // a strategy name where "0"/"1" was optional
+        }
+
+        std::string strategyName;
+        if (fields >> strategyName) {
+            const Strategy* strategy = findStrategy(strategyName);
+            if (!strategy) throw std::runtime_error("unknown strategy " + strategyName + " for " + name);
+            controller.setStrategy(p, strategy);
+        }
+
+        players.push_back(p);
+    }
+
+    std::string propertyName, owner;
+    int improvements;
+    while (in >> propertyName >> owner >> improvements) {
+        auto* b = controller.getBuilding(propertyName);
+        if (!b) {
+            std::cerr << "[Warning] Could not find building with name: "
+                      << propertyName << " (skipping)\n";
+            continue;
+        }
+
+        if (owner != "BANK") {
+            for (auto* p : players) {
+                if (p->getName() == owner) {
+                    b->setOwner(p);
+                    break;
+                }
+            }
+        }
+
+        if (improvements == -1) {
+            Player* ownerPlayer = b->getOwner();
+            if (!ownerPlayer) {
+                std::cerr << "[ERROR] Couldn't find owner for mortgaging: "
+                          << b->getName() << " with token: " << b->getOwnerToken() << "\n";
+                continue;
+            }
+            // Only the flag: the saved money already reflects the mortgage.
+            b->setMortgaged(true);
+        } else if (auto* ab = dynamic_cast<AcademicBuilding*>(b)) {
+            if (improvements < 0 || improvements > 5) {
+                throw std::runtime_error("bad improvement count " + std::to_string(improvements) + " for " +
+                                         propertyName);
+            }
+            ab->forceSetImprovements(improvements);
+        } else if (improvements != 0) {
+            // Non-academic buildings can't have improvements
+            std::cerr << "[Warning] Non-academic building " << b->getName()
+                      << " cannot have improvements. Ignoring improvement count: "
+                      << improvements << "\n";
+        }
+    }
+
+    return players;
+}
@@ -0,0 +1,41 @@
+// Save-File.cc (interface)
+// Module: SaveFile
+// Description:
+//   Reading and writing the plain-text save file used by main.cc's "save"
+//   command and "-load file" option, so the same code serves the game, the
+//   tests and the benchmarks.
+//
+//   Format (whitespace separated):
+//     <number of players>
+//     <name> <token> <cups> <money> <position> [1 <turns in Tims>] [strategy]
+//                                   one line per player, in turn order
+//     <building> <owner name | BANK> <improvements | -1 if mortgaged> one per building
+//
+//   A player line ending in a strategy name (see Strategy) is a computer
+//   player; without one the seat is human. At position 10, "0" in place
+//   of "1 <turns>" (not in the Tims line) is also accepted.
+//
+// Related Modules:
+//   - Game (players are added to it on load)
+//   - GameController (buildings by name, and each seat's strategy)
+//   - Building (mortgages are restored as a flag; money is not touched)
+
+export module SaveFile;
+
+import <iostream>;
+import <vector>;
+import Player;
+import Board;
+import Game;
+import GameController;
+
+// Writes the players (in turn order, with the strategy controller has for
+// each) and every building on the board.
+export void writeSaveFile(std::ostream& out, const std::vector<Player*>& players, const Board& board,
+                          const GameController& controller);
+
+// Adds the saved players to a game that has none yet, restores owners,
+// improvements, mortgages and strategies, and returns the players in turn
+// order. Throws std::runtime_error if the file does not list 2-8 players
+// or names an unknown strategy.
+export std::vector<Player*> readSaveFile(std::istream& in, Game& game);
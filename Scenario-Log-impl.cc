@@ -0,0 +1,49 @@
+// Scenario-Log-impl.cc (implementation)
+// Module: ScenarioLog
+// Description:
+//   Event recording and the per-controller block written for run-scenarios.
+
+module ScenarioLog;
+
+import <cstdlib>;
+import <fstream>;
+import <iomanip>;
+
+const char* ScenarioLog::path() {
+    const char* file = std::getenv("WATOPOLY_SCENARIO_LOG");
+    return file && *file ? file : nullptr;
+}
+
+void ScenarioLog::record(const SpectatorEvent& ev, std::uint64_t state) {
+    log.push_back(ev);
+    this->state = state;
+}
+
+void ScenarioLog::noteState(std::uint64_t state) {
+    this->state = state;
+}
+
+const std::vector<SpectatorEvent>& ScenarioLog::events() const {
+    return log;
+}
+
+std::uint64_t ScenarioLog::finalState() const {
+    return state;
+}
+
+void ScenarioLog::write(std::ostream& out) const {
+    out << "CONTROLLER\n";
+    for (const SpectatorEvent& ev : log) out << formatSpectatorEvent(ev) << "\n";
+
+    std::ios_base::fmtflags flags = out.flags();
+    out << "STATE " << std::hex << std::setw(16) << std::setfill('0') << state << "\n";
+    out.flags(flags);
+    out.fill(' ');
+}
+
+void ScenarioLog::append() const {
+    const char* file = path();
+    if (!file) return;
+    std::ofstream out(file, std::ios::app);
+    write(out);
+}
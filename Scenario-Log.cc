@@ -0,0 +1,54 @@
+// Scenario-Log.cc (interface)
+// Module: ScenarioLog
+// Description:
+//   What the golden-output runner (run-scenarios) compares for each
+//   scenario program: the delta events a GameController published (the
+//   same records the spectator feed carries) and a hash of the game state
+//   after the last of them.
+//
+//   Recording is switched on from outside the program: when the
+//   environment variable WATOPOLY_SCENARIO_LOG names a file, every
+//   GameController keeps a ScenarioLog and appends it to that file when it
+//   is destroyed. Scenario programs need no changes, and nothing is
+//   recorded in normal runs.
+//
+//   File format, one block per controller in destruction order:
+//     CONTROLLER
+//     <TYPE> <square> <actor> <other> <a> <b>    one line per event
+//     STATE <16 hex digits>
+//
+// Related Modules:
+//   - Spectator (event records and their text form)
+//   - GameController (records into its log; see stateHash())
+
+export module ScenarioLog;
+
+import <cstdint>;
+import <ostream>;
+import <vector>;
+import Spectator;
+
+export class ScenarioLog {
+public:
+    // The file named by WATOPOLY_SCENARIO_LOG, or nullptr when recording is off.
+    static const char* path();
+
+    // Appends an event; state is the hash of the game right after it.
+    void record(const SpectatorEvent& ev, std::uint64_t state);
+
+    // Replaces the final state hash (e.g. at the end of a turn).
+    void noteState(std::uint64_t state);
+
+    const std::vector<SpectatorEvent>& events() const;
+    std::uint64_t finalState() const;
+
+    // Writes the block described above.
+    void write(std::ostream& out) const;
+
+    // Appends write() to path(); does nothing when recording is off.
+    void append() const;
+
+private:
+    std::vector<SpectatorEvent> log;
+    std::uint64_t state = 0;
+};
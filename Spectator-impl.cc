@@ -0,0 +1,220 @@
+// Spectator-impl.cc (implementation)
+// Module: Spectator
+// Description:
+//   Implements the lock-free event ring and the background writer that
+//   streams events to viewers over a Unix domain socket or FIFO.
+//
+//   Wire format (one line per event, space separated):
+//     <seq> <TYPE> <square> <actor> <other> <a> <b>
+//   where an empty token is written as BANK. Gaps are announced with
+//     DROPPED <count>
+//
+//   All viewer I/O is non-blocking and happens on the writer thread only.
+
+module;
+#include <cerrno>
+#include <csignal>
+#include <fcntl.h>
+#include <sys/socket.h>
+#include <sys/stat.h>
+#include <sys/un.h>
+#include <unistd.h>
+
+module Spectator;
+
+import <chrono>;
+import <cstring>;
+
+void setEventToken(char (&slot)[4], const std::string& token) {
+    std::size_t n = token.size() < 3 ? token.size() : 3;
+    for (std::size_t i = 0; i < n; ++i) slot[i] = token[i];
+    slot[n] = '\0';
+}
+
+static const char* eventTypeName(SpectatorEventType t) {
+    switch (t) {
+        case SpectatorEventType::Turn:        return "TURN";
+        case SpectatorEventType::Dice:        return "DICE";
+        case SpectatorEventType::Move:        return "MOVE";
+        case SpectatorEventType::Transfer:    return "PAY";
+        case SpectatorEventType::Ownership:   return "OWN";
+        case SpectatorEventType::Improvement: return "IMPROVE";
+        case SpectatorEventType::Mortgage:    return "MORTGAGE";
+        case SpectatorEventType::Tims:        return "TIMS";
+        case SpectatorEventType::Bankrupt:    return "BANKRUPT";
+    }
+    return "?";
+}
+
+std::string formatSpectatorEvent(const SpectatorEvent& ev) {
+    std::string line = eventTypeName(ev.type);
+    line += ' ';
+    line += std::to_string(ev.square);
+    line += ' ';
+    line += ev.actor[0] ? ev.actor : "BANK";
+    line += ' ';
+    line += ev.other[0] ? ev.other : "BANK";
+    line += ' ';
+    line += std::to_string(ev.a);
+    line += ' ';
+    line += std::to_string(ev.b);
+    return line;
+}
+
+SpectatorChannel::SpectatorChannel(const std::string& path) : path{path} {
+    struct stat st;
+    const bool exists = ::lstat(path.c_str(), &st) == 0;
+    if (exists && S_ISFIFO(st.st_mode)) {
+        // FIFO: opened lazily by the writer once a reader shows up.
+        fifoMode = true;
+    } else if (exists && !S_ISSOCK(st.st_mode)) {
+        // Never replace anything but a stale socket; the feed stays off.
+    } else if (path.size() < sizeof(sockaddr_un::sun_path)) {
+        if (exists) ::unlink(path.c_str());
+        listenFd = ::socket(AF_UNIX, SOCK_STREAM | SOCK_NONBLOCK | SOCK_CLOEXEC, 0);
+        if (listenFd >= 0) {
+            sockaddr_un addr{};
+            addr.sun_family = AF_UNIX;
+            std::strncpy(addr.sun_path, path.c_str(), sizeof(addr.sun_path) - 1);
+            if (::bind(listenFd, reinterpret_cast<sockaddr*>(&addr), sizeof(addr)) != 0 ||
+                ::listen(listenFd, 8) != 0) {
+                ::close(listenFd);
+                listenFd = -1;
+            } else {
+                socketCreated = true;
+            }
+        }
+    }
+
+    writer = std::thread([this] { writerLoop(); });
+}
+
+SpectatorChannel::~SpectatorChannel() {
+    running.store(false, std::memory_order_release);
+    if (writer.joinable()) writer.join();
+
+    for (auto& v : viewers) ::close(v.fd);
+    if (listenFd >= 0) ::close(listenFd);
+    if (socketCreated) ::unlink(path.c_str());
+}
+
+bool SpectatorChannel::publish(const SpectatorEvent& ev) noexcept {
+    std::size_t h = head.load(std::memory_order_relaxed);
+    // Stamped here, so events lost to a full ring leave a gap in the
+    // sequence the viewer sees.
+    const std::uint64_t sequence = ++published;
+    if (h - tail.load(std::memory_order_acquire) >= Capacity) {
+        ringDrops.fetch_add(1, std::memory_order_relaxed);
+        return false;
+    }
+    ring[h & (Capacity - 1)] = {ev, sequence};
+    head.store(h + 1, std::memory_order_release);
+    return true;
+}
+
+std::uint64_t SpectatorChannel::droppedCount() const {
+    return ringDrops.load(std::memory_order_relaxed) + viewerDrops.load(std::memory_order_relaxed);
+}
+
+bool SpectatorChannel::isOpen() const {
+    return fifoMode || listenFd >= 0;
+}
+
+// Picks up new socket viewers, or (re)opens the FIFO once a reader exists.
+void SpectatorChannel::acceptViewers() {
+    if (fifoMode) {
+        if (!viewers.empty()) return;
+        int fd = ::open(path.c_str(), O_WRONLY | O_NONBLOCK | O_CLOEXEC);
+        if (fd >= 0) viewers.push_back({fd, {}});
+        return;
+    }
+
+    if (listenFd < 0) return;
+    while (true) {
+        int fd = ::accept4(listenFd, nullptr, nullptr, SOCK_NONBLOCK | SOCK_CLOEXEC);
+        if (fd < 0) break;
+        viewers.push_back({fd, {}});
+    }
+}
+
+// Appends a line to every viewer's backlog. A viewer that has fallen more
+// than MaxBacklog bytes behind loses its backlog, which is replaced by a
+// single DROPPED marker.
+void SpectatorChannel::broadcast(const std::string& line) {
+    for (auto& v : viewers) {
+        if (v.backlog.size() + line.size() > MaxBacklog) {
+            std::uint64_t lost = 0;
+            for (char c : v.backlog) if (c == '\n') ++lost;
+            viewerDrops.fetch_add(lost + 1, std::memory_order_relaxed);
+            v.backlog = "DROPPED " + std::to_string(lost + 1) + "\n";
+            continue;
+        }
+        v.backlog += line;
+    }
+}
+
+// Writes as much of each backlog as the descriptor accepts without blocking.
+// Viewers that hung up are removed.
+void SpectatorChannel::flushViewers() {
+    for (std::size_t i = 0; i < viewers.size();) {
+        Viewer& v = viewers[i];
+        bool gone = false;
+        while (!v.backlog.empty()) {
+            ssize_t n = fifoMode
+                ? ::write(v.fd, v.backlog.data(), v.backlog.size())
+                : ::send(v.fd, v.backlog.data(), v.backlog.size(), MSG_NOSIGNAL);
+            if (n > 0) {
+                v.backlog.erase(0, static_cast<std::size_t>(n));
+            } else {
+                gone = !(n < 0 && (errno == EAGAIN || errno == EWOULDBLOCK || errno == EINTR));
+                break;
+            }
+        }
+        if (gone) {
+            ::close(v.fd);
+            viewers.erase(viewers.begin() + i);
+        } else {
+            ++i;
+        }
+    }
+}
+
+void SpectatorChannel::writerLoop() {
+    // A FIFO reader going away raises SIGPIPE in the writing thread; keep it
+    // pending here so write() just reports EPIPE.
+    sigset_t pipeMask;
+    sigemptyset(&pipeMask);
+    sigaddset(&pipeMask, SIGPIPE);
+    pthread_sigmask(SIG_BLOCK, &pipeMask, nullptr);
+
+    std::string line;
+    while (true) {
+        bool stopping = !running.load(std::memory_order_acquire);
+        acceptViewers();
+
+        std::uint64_t drops = ringDrops.load(std::memory_order_relaxed);
+        if (drops != reportedDrops) {
+            broadcast("DROPPED " + std::to_string(drops - reportedDrops) + "\n");
+            reportedDrops = drops;
+        }
+
+        std::size_t t = tail.load(std::memory_order_relaxed);
+        std::size_t h = head.load(std::memory_order_acquire);
+        bool idle = (t == h);
+
+        for (; t != h; ++t) {
+            const Slot& slot = ring[t & (Capacity - 1)];
+            line = std::to_string(slot.sequence);
+            line += ' ';
+            line += formatSpectatorEvent(slot.event);
+            line += '\n';
+            if (!viewers.empty()) broadcast(line);
+        }
+        tail.store(t, std::memory_order_release);
+
+        flushViewers();
+
+        if (stopping && idle) break;
+        if (idle) std::this_thread::sleep_for(std::chrono::milliseconds(2));
+    }
+}
@@ -0,0 +1,122 @@
+// Spectator.cc (interface)
+// Module: Spectator
+// Description:
+//   Optional live feed of a running game for external viewers and dashboards.
+//   GameController publishes compact per-turn delta events (dice, moves,
+//   money transfers, ownership/improvement/mortgage changes) into a bounded
+//   lock-free ring. A background writer thread drains the ring and streams
+//   one text line per event to a Unix domain socket or a FIFO.
+//
+//   Gameplay never waits on a viewer:
+//     - publish() is a single-producer push that fails instead of blocking
+//       when the ring is full (the loss is counted, not retried)
+//     - the writer uses non-blocking I/O and discards a viewer's backlog
+//       once it grows past a fixed limit
+//   Every gap is reported to viewers as a "DROPPED <n>" line, and each event
+//   carries the sequence number publish() gave it (dropped events use one
+//   up too), so a viewer can tell exactly what it missed.
+//
+// Related Modules:
+//   - GameController (the only producer; see setSpectator())
+//   - main.cc (enables the channel with "-spectate <path>")
+
+export module Spectator;
+
+import <array>;
+import <atomic>;
+import <cstdint>;
+import <string>;
+import <thread>;
+import <vector>;
+
+export enum class SpectatorEventType : std::uint8_t {
+    Turn,         ///< A player starts a turn            (square = position)
+    Dice,         ///< Dice rolled                       (a, b = dice)
+    Move,         ///< Player moved                      (a = from, square = to)
+    Transfer,     ///< Money moved actor -> other/bank   (a = amount)
+    Ownership,    ///< Property changed hands            (actor = new owner, other = old)
+    Improvement,  ///< Improvement count changed         (a = new count)
+    Mortgage,     ///< Mortgage status changed           (a = 1 mortgaged, 0 cleared)
+    Tims,         ///< Entered or left DC Tims Line      (a = 1 entered, 0 left)
+    Bankrupt      ///< Player is out of the game         (other = creditor/bank)
+};
+
+// Fixed-size, allocation-free event record. Tokens are truncated to 3 chars;
+// an empty token means the Bank.
+export struct SpectatorEvent {
+    SpectatorEventType type = SpectatorEventType::Turn;
+    std::uint8_t square = 0;
+    char actor[4] = {};
+    char other[4] = {};
+    std::int32_t a = 0;
+    std::int32_t b = 0;
+};
+
+// Copies a player token into an event token slot (truncating, NUL-terminated).
+export void setEventToken(char (&slot)[4], const std::string& token);
+
+// An event as the feed writes it, without the sequence number:
+//   <TYPE> <square> <actor> <other> <a> <b>
+export std::string formatSpectatorEvent(const SpectatorEvent& ev);
+
+export class SpectatorChannel {
+public:
+    static constexpr std::size_t Capacity = 1024;        // ring slots (power of two)
+    static constexpr std::size_t MaxBacklog = 64 * 1024;  // bytes buffered per viewer
+
+    // Opens the feed at `path`. An existing FIFO is written to directly;
+    // otherwise a Unix domain socket is created there (replacing a stale
+    // socket) and viewers connect to it. Any other existing file is left
+    // alone and the channel stays closed (isOpen() is false).
+    explicit SpectatorChannel(const std::string& path);
+
+    // Stops the writer thread and closes all descriptors.
+    ~SpectatorChannel();
+
+    SpectatorChannel(const SpectatorChannel&) = delete;
+    SpectatorChannel& operator=(const SpectatorChannel&) = delete;
+
+    // Queues an event for viewers. Never blocks; returns false if the event
+    // was dropped because the ring was full.
+    bool publish(const SpectatorEvent& ev) noexcept;
+
+    // Total events lost so far (full ring or slow viewer).
+    std::uint64_t droppedCount() const;
+
+    // Whether the FIFO/socket could be set up.
+    bool isOpen() const;
+
+private:
+    struct Viewer {
+        int fd;
+        std::string backlog;
+    };
+
+    struct Slot {
+        SpectatorEvent event;
+        std::uint64_t sequence;
+    };
+
+    // Single-producer/single-consumer ring; head and tail live on separate
+    // cache lines so the game thread and writer thread don't false-share.
+    std::array<Slot, Capacity> ring;
+    alignas(64) std::atomic<std::size_t> head{0};   // next slot to write (game thread)
+    alignas(64) std::atomic<std::size_t> tail{0};   // next slot to read (writer thread)
+    alignas(64) std::atomic<std::uint64_t> ringDrops{0};
+    std::atomic<std::uint64_t> viewerDrops{0};
+    std::atomic<bool> running{true};
+
+    std::string path;
+    bool fifoMode = false;
+    bool socketCreated = false;
+    int listenFd = -1;
+    std::vector<Viewer> viewers;   // writer thread only
+    std::uint64_t published = 0;   // sequence of the last event offered (game thread only)
+    std::uint64_t reportedDrops = 0;
+    std::thread writer;
+
+    void writerLoop();
+    void acceptViewers();
+    void broadcast(const std::string& line);
+    void flushViewers();
+};
@@ -0,0 +1,109 @@
+// Square-Names.cc (interface)
+// Module: SquareNames
+// Description:
+//   Compile-time perfect hash over the standard Watopoly square names.
+//
+//   The 36 distinct names of the standard board (SLC and NEEDLES HALL appear
+//   more than once; the first position is used) are hashed with a seeded
+//   FNV-1a into a 128-slot table. The seed is searched for at compile time
+//   until no two names share a slot, so a lookup is one short hash, one
+//   table load and one string_view compare to reject unknown names. No
+//   allocation, no map, no scan.
+//
+//   Board only uses this when its squares are the standard layout (see
+//   Board::getSquareByName); any other layout falls back to a scan.
+//
+// Related Modules:
+//   - Board (getSquareByName / indexOf)
+//   - GameController (getBuilding resolves names through Board)
+
+export module SquareNames;
+
+import <array>;
+import <cstdint>;
+import <string_view>;
+
+export struct CanonicalSquare {
+    std::string_view name;
+    int position;
+};
+
+// Every distinct square name on the standard board, with its first position.
+export inline constexpr std::array<CanonicalSquare, 36> canonicalSquares{{
+    {"COLLECT OSAP", 0}, {"AL", 1}, {"SLC", 2}, {"ML", 3}, {"TUITION", 4},
+    {"MKV", 5}, {"ECH", 6}, {"NEEDLES HALL", 7}, {"PAS", 8}, {"HH", 9},
+    {"DC Tims Line", 10}, {"RCH", 11}, {"PAC", 12}, {"DWE", 13}, {"CPH", 14},
+    {"UWP", 15}, {"LHI", 16}, {"BMH", 18}, {"OPT", 19}, {"Goose Nesting", 20},
+    {"EV1", 21}, {"EV2", 23}, {"EV3", 24}, {"V1", 25}, {"PHYS", 26},
+    {"B1", 27}, {"CIF", 28}, {"B2", 29}, {"GO TO TIMS", 30}, {"EIT", 31},
+    {"ESC", 32}, {"C2", 34}, {"REV", 35}, {"MC", 37}, {"COOP FEE", 38},
+    {"DC", 39}
+}};
+
+namespace square_names_detail {
+
+inline constexpr std::size_t Slots = 128;  // power of two, ~4x the key count
+
+constexpr std::uint32_t hash(std::uint32_t seed, std::string_view s) {
+    std::uint32_t h = 2166136261u ^ seed;
+    for (char c : s) {
+        h ^= static_cast<unsigned char>(c);
+        h *= 16777619u;
+    }
+    return h ^ (h >> 16);
+}
+
+constexpr bool isPerfect(std::uint32_t seed) {
+    std::array<bool, Slots> used{};
+    for (const auto& sq : canonicalSquares) {
+        std::size_t slot = hash(seed, sq.name) & (Slots - 1);
+        if (used[slot]) return false;
+        used[slot] = true;
+    }
+    return true;
+}
+
+constexpr std::uint32_t findSeed() {
+    std::uint32_t seed = 0;
+    while (!isPerfect(seed)) ++seed;
+    return seed;
+}
+
+inline constexpr std::uint32_t Seed = findSeed();
+
+// slot -> index into canonicalSquares, or -1
+constexpr std::array<std::int8_t, Slots> buildTable() {
+    std::array<std::int8_t, Slots> table{};
+    table.fill(-1);
+    for (std::size_t i = 0; i < canonicalSquares.size(); ++i) {
+        table[hash(Seed, canonicalSquares[i].name) & (Slots - 1)] = static_cast<std::int8_t>(i);
+    }
+    return table;
+}
+
+inline constexpr std::array<std::int8_t, Slots> Table = buildTable();
+
+}  // namespace square_names_detail
+
+// Board position of a standard square name, or -1 if it is not one.
+export constexpr int canonicalSquareIndex(std::string_view name) {
+    using namespace square_names_detail;
+    int entry = Table[hash(Seed, name) & (Slots - 1)];
+    if (entry < 0 || canonicalSquares[entry].name != name) return -1;
+    return canonicalSquares[entry].position;
+}
+
+constexpr bool everyNameResolves() {
+    for (const auto& sq : canonicalSquares) {
+        if (canonicalSquareIndex(sq.name) != sq.position) return false;
+    }
+    return true;
+}
+
+static_assert(everyNameResolves());
+static_assert(canonicalSquareIndex("COLLECT OSAP") == 0);
+static_assert(canonicalSquareIndex("DC Tims Line") == 10);
+static_assert(canonicalSquareIndex("NEEDLES HALL") == 7);
+static_assert(canonicalSquareIndex("REV") == 35);
+static_assert(canonicalSquareIndex("DC") == 39);
+static_assert(canonicalSquareIndex("NOPE") == -1);
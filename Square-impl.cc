@@ -5,12 +5,12 @@
 
 module Square;
 
-// Constructor for Square: initializes the name and board position.
-Square::Square(std::string name, int position) : name{name}, position{position} {}
+// Constructor for Square: records its definition and board position.
+Square::Square(const BoardDefinition& layout, int position) : layout{&layout}, position{position} {}
 
 // Returns the name of the square.
-std::string Square::getName() const {
-    return name;
+const std::string& Square::getName() const {
+    return definition().name;
 }
 
 // Returns the position of the square on the board (0-indexed).
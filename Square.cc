@@ -9,10 +9,14 @@
 //   All subclasses must override onLand(Player*) to define what happens
 //   when a player lands on that square.
 //
+//   A square stores no static data of its own: its name (and, for
+//   buildings, price and rents) is read from the shared BoardDefinition
+//   it was built from, at its position.
+//
 // Related Modules:
 //   - Player (used as forward dependency)
 //   - Building, AcademicBuilding, Residence, Gym (inherit from Square)
-//   - Board (stores std::vector<Square*>)
+//   - Board (stores its Squares contiguously, indexed by position)
 //   - GameController (invokes square->onLand(player) to trigger effects)
 
 export module Square;
@@ -21,21 +25,25 @@ import <iostream>;
 import <string>;
 import LandAction;
 import Player;
+import BoardDefinition;
 
 export class Square {
 protected:
-    std::string name;     // Display name of the square (e.g., "EV1", "MKV")
-    int position;         // Board index (0-based from "Collect OSAP")
+    const BoardDefinition* layout;  // Shared static data (name, price, rents)
+    int position;                   // Board index (0-based from "Collect OSAP")
+
+    // This square's entry in the definition.
+    inline const SquareDefinition& definition() const { return layout->squares[position]; }
 
 public:
-    // Constructs a Square with a name and position on the board.
-    Square(std::string name, int position);
+    // Constructs the square at a position of a board definition.
+    Square(const BoardDefinition& layout, int position);
 
     // Virtual destructor to allow polymorphic deletion.
     virtual ~Square() = default;
 
     // Returns the display name of the square.
-    std::string getName() const;
+    const std::string& getName() const;
 
     // Returns the position index of the square on the board.
     int getPosition() const;
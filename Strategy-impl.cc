@@ -0,0 +1,291 @@
+// Strategy-impl.cc (implementation)
+// Module: Strategy
+// Description:
+//   The default answers and the built-in strategies. Square data comes
+//   from the board definition and ownership from the board state, so no
+//   answer walks the board or looks at square objects beyond b's position.
+
+module Strategy;
+
+import <algorithm>;
+import <array>;
+import <deque>;
+import <mutex>;
+import <sstream>;
+import BoardDefinition;
+import BoardState;
+import BlockIndex;
+import PropertySet;
+
+namespace {
+
+// Members of block held by anyone but p.
+PropertySet heldByOthers(const Player& p, PropertySet members, const Board& board) {
+    PropertySet others;
+    for (int pos : members) {
+        const Player* owner = board.getState().ownership.ownerOf(pos);
+        if (owner && owner != &p) others.insert(pos);
+    }
+    return others;
+}
+
+// Would owning position give p the whole of its block?
+bool completesBlock(const Player& p, int position, const Board& board) {
+    const BlockIndex& blocks = board.getBlocks();
+    int block = blocks.blockOf(position);
+    if (block == BlockIndex::None) return false;
+    PropertySet owned = p.getProperties();
+    owned.insert(position);
+    return blocks.ownsAll(owned, block);
+}
+
+// Does p hold every member of position's block?
+bool inOwnMonopoly(const Player& p, int position, const Board& board) {
+    const BlockIndex& blocks = board.getBlocks();
+    int block = blocks.blockOf(position);
+    return block != BlockIndex::None && blocks.ownsAll(p.getProperties(), block);
+}
+
+// Cash p holds above reserve (negative when below it).
+int spareCash(const Player& p, int reserve) {
+    return p.getMoney() - reserve;
+}
+
+// What b is worth to p under BlockFocusedStrategy's rules.
+int blockValue(const Player& p, const Building& b, const Board& board, double premium) {
+    int position = b.getPosition();
+    int price = b.getPrice();
+    const BlockIndex& blocks = board.getBlocks();
+    int block = blocks.blockOf(position);
+    if (block == BlockIndex::None) return price;  // residences and gyms
+    if (completesBlock(p, position, board)) return static_cast<int>(price * premium);
+
+    PropertySet members = blocks.members(block);
+    PropertySet others = heldByOthers(p, members, board);
+    if (others.empty()) return price;  // still ours to complete
+
+    // Another player holds the rest: buying it denies them the block.
+    Player* rival = board.getState().ownership.ownerOf(*others.begin());
+    PropertySet rest = members;
+    rest.erase(position);
+    return (rival->getProperties() & members) == rest ? price : price / 2;
+}
+
+}  // namespace
+
+// ====== Defaults ======
+
+bool Strategy::useRollUpCup(const Player&, const Board&) const {
+    return true;
+}
+
+bool Strategy::payTimsFine(const Player&, const Board&) const {
+    return true;
+}
+
+bool Strategy::payTuitionPercent(const Player& p) const {
+    return p.getTotalWorth() / 10 < 300;
+}
+
+bool Strategy::acceptTrade(const Player& p, const TradeOffer& offer, const Board& board) const {
+    if (offer.gives && inOwnMonopoly(p, offer.gives->getPosition(), board)) return false;
+    int in = offer.gets ? offer.gets->getPrice() : offer.cashIn;
+    int out = offer.gives ? offer.gives->getPrice() : offer.cashOut;
+    return in > out && p.getMoney() >= offer.cashOut;
+}
+
+int rentIfOwned(const Player& p, int position, const Board& board) {
+    const BoardDefinition& def = board.getDefinition();
+    const SquareDefinition& square = def.squares[position];
+    PropertySet owned = p.getProperties();
+    owned.insert(position);
+
+    switch (square.kind) {
+        case SquareKind::Academic:
+            return square.rent[0] * (completesBlock(p, position, board) ? 2 : 1);
+        case SquareKind::Residence:
+            return def.residenceRent[std::min((owned & def.residences).size(), 4)];
+        case SquareKind::Gym:
+            return def.gymMultiplier[std::min((owned & def.gyms).size(), 2)] * 7;
+        default:
+            return 0;
+    }
+}
+
+// ====== always-buy ======
+
+std::string_view AlwaysBuyStrategy::name() const {
+    return "always-buy";
+}
+
+bool AlwaysBuyStrategy::buy(const Player& p, const Building& b, const Board&) const {
+    return p.getMoney() >= b.getPrice();
+}
+
+int AlwaysBuyStrategy::maxBid(const Player&, const Building& b, const Board&) const {
+    return b.getPrice();
+}
+
+bool AlwaysBuyStrategy::improve(const Player&, const AcademicBuilding&, const Board&) const {
+    return true;
+}
+
+// ====== block-focused ======
+
+BlockFocusedStrategy::BlockFocusedStrategy(double premium, int reserve)
+    : premium{premium}, reserve{reserve} {}
+
+std::string_view BlockFocusedStrategy::name() const {
+    return "block-focused";
+}
+
+bool BlockFocusedStrategy::buy(const Player& p, const Building& b, const Board& board) const {
+    return spareCash(p, reserve) >= b.getPrice() && blockValue(p, b, board, premium) >= b.getPrice();
+}
+
+int BlockFocusedStrategy::maxBid(const Player& p, const Building& b, const Board& board) const {
+    return std::max(0, std::min(blockValue(p, b, board, premium), spareCash(p, reserve)));
+}
+
+bool BlockFocusedStrategy::improve(const Player& p, const AcademicBuilding& ab, const Board&) const {
+    return spareCash(p, reserve) >= ab.getImprovementCost();
+}
+
+bool BlockFocusedStrategy::acceptTrade(const Player& p, const TradeOffer& offer, const Board& board) const {
+    if (offer.gives && inOwnMonopoly(p, offer.gives->getPosition(), board)) return false;
+    if (offer.gets && completesBlock(p, offer.gets->getPosition(), board)) {
+        return p.getMoney() >= offer.cashOut;
+    }
+    return Strategy::acceptTrade(p, offer, board);
+}
+
+// ====== cash-conservative ======
+
+CashConservativeStrategy::CashConservativeStrategy(int reserve) : reserve{reserve} {}
+
+std::string_view CashConservativeStrategy::name() const {
+    return "cash-conservative";
+}
+
+bool CashConservativeStrategy::buy(const Player& p, const Building& b, const Board&) const {
+    return spareCash(p, reserve) >= b.getPrice();
+}
+
+int CashConservativeStrategy::maxBid(const Player& p, const Building& b, const Board&) const {
+    return std::max(0, std::min(b.getPrice(), spareCash(p, reserve)));
+}
+
+bool CashConservativeStrategy::improve(const Player& p, const AcademicBuilding& ab, const Board&) const {
+    return spareCash(p, reserve) >= ab.getImprovementCost();
+}
+
+bool CashConservativeStrategy::payTimsFine(const Player&, const Board&) const {
+    return false;
+}
+
+bool CashConservativeStrategy::acceptTrade(const Player& p, const TradeOffer& offer, const Board& board) const {
+    return Strategy::acceptTrade(p, offer, board) && spareCash(p, reserve) >= offer.cashOut;
+}
+
+// ====== roi-threshold ======
+
+RoiThresholdStrategy::RoiThresholdStrategy(double threshold, int reserve)
+    : threshold{threshold}, reserve{reserve} {}
+
+std::string_view RoiThresholdStrategy::name() const {
+    return "roi-threshold";
+}
+
+bool RoiThresholdStrategy::buy(const Player& p, const Building& b, const Board& board) const {
+    return spareCash(p, reserve) >= b.getPrice() &&
+           rentIfOwned(p, b.getPosition(), board) >= threshold * b.getPrice();
+}
+
+int RoiThresholdStrategy::maxBid(const Player& p, const Building& b, const Board& board) const {
+    int worth = static_cast<int>(rentIfOwned(p, b.getPosition(), board) / threshold);
+    return std::max(0, std::min(worth, spareCash(p, reserve)));
+}
+
+bool RoiThresholdStrategy::improve(const Player& p, const AcademicBuilding& ab, const Board&) const {
+    int level = ab.getImprovementCount();
+    int gain = ab.rentAtLevel(level + 1, true) - ab.rentAtLevel(level, true);
+    return spareCash(p, reserve) >= ab.getImprovementCost() &&
+           gain >= threshold * ab.getImprovementCost();
+}
+
+// ====== tuned ======
+
+ParametricStrategy::ParametricStrategy(const StrategyParams& params) : genome{params} {
+    std::ostringstream out;
+    out << "tuned:" << genome.buyThreshold << "," << genome.improveThreshold << ","
+        << genome.cashReserve << "," << genome.bidFraction;
+    label = out.str();
+}
+
+std::string_view ParametricStrategy::name() const {
+    return label;
+}
+
+const StrategyParams& ParametricStrategy::params() const {
+    return genome;
+}
+
+bool ParametricStrategy::buy(const Player& p, const Building& b, const Board& board) const {
+    return spareCash(p, genome.cashReserve) >= b.getPrice() &&
+           rentIfOwned(p, b.getPosition(), board) >= genome.buyThreshold * b.getPrice();
+}
+
+int ParametricStrategy::maxBid(const Player& p, const Building& b, const Board&) const {
+    int bid = static_cast<int>(genome.bidFraction * b.getPrice());
+    return std::max(0, std::min(bid, spareCash(p, genome.cashReserve)));
+}
+
+bool ParametricStrategy::improve(const Player& p, const AcademicBuilding& ab, const Board&) const {
+    int level = ab.getImprovementCount();
+    int gain = ab.rentAtLevel(level + 1, true) - ab.rentAtLevel(level, true);
+    return spareCash(p, genome.cashReserve) >= ab.getImprovementCost() &&
+           gain >= genome.improveThreshold * ab.getImprovementCost();
+}
+
+bool ParametricStrategy::payTimsFine(const Player& p, const Board&) const {
+    return spareCash(p, genome.cashReserve) >= 50;
+}
+
+// ====== Registry ======
+
+std::span<const Strategy* const> builtinStrategies() {
+    static const AlwaysBuyStrategy alwaysBuy;
+    static const BlockFocusedStrategy blockFocused;
+    static const CashConservativeStrategy cashConservative;
+    static const RoiThresholdStrategy roiThreshold;
+    static const std::array<const Strategy*, 4> all = {
+        &alwaysBuy, &blockFocused, &cashConservative, &roiThreshold
+    };
+    return all;
+}
+
+const Strategy* findStrategy(std::string_view name) {
+    for (const Strategy* s : builtinStrategies()) {
+        if (s->name() == name) return s;
+    }
+
+    constexpr std::string_view tuned = "tuned:";
+    if (!name.starts_with(tuned)) return nullptr;
+    std::istringstream fields{std::string{name.substr(tuned.size())}};
+    StrategyParams params;
+    char c1 = 0, c2 = 0, c3 = 0;
+    fields >> params.buyThreshold >> c1 >> params.improveThreshold >> c2
+           >> params.cashReserve >> c3 >> params.bidFraction;
+    if (!fields || c1 != ',' || c2 != ',' || c3 != ',' || fields.peek() != std::char_traits<char>::eof()) {
+        return nullptr;
+    }
+
+    // Parsed sets live for the program; a deque never moves its elements.
+    static std::mutex lock;
+    static std::deque<ParametricStrategy> parsed;
+    std::lock_guard<std::mutex> guard{lock};
+    for (const ParametricStrategy& s : parsed) {
+        if (s.params() == params) return &s;
+    }
+    return &parsed.emplace_back(params);
+}
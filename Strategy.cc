@@ -0,0 +1,185 @@
+// Strategy.cc (interface)
+// Module: Strategy
+// Description:
+//   Computer players. A Strategy answers every decision GameController
+//   would otherwise read from std::cin: buying the square landed on,
+//   auction bids, leaving the Tims line, the Tuition payment method, trade
+//   offers, and which improvements to build at the end of a turn. Raising
+//   funds needs no answer: bots always use the automatic liquidation plan.
+//
+//   Strategies are stateless, read the game only through const references
+//   and never do I/O, so one instance can serve any number of seats and
+//   games at once. The built-in ones look only at the board definition,
+//   the owner table and the player's own sets, so each answer is a few
+//   bit operations:
+//     always-buy         buys everything it can afford, bids up to the price
+//     block-focused      buys what it can still complete (or deny), and pays
+//                        a premium for squares that complete a block
+//     cash-conservative  buys only while it keeps a cash reserve
+//     roi-threshold      buys when rent per landing / price reaches a threshold
+//   and one family with every rule a parameter (see StrategyParams), named
+//   "tuned:<buy>,<improve>,<reserve>,<bid>", for the Tuner to evolve.
+//
+//   A seat is assigned a strategy with GameController::setStrategy (at
+//   setup, or from the save file); seats without one are human.
+//
+// Related Modules:
+//   - GameController (asks the seat's strategy at each decision point)
+//   - SaveFile (stores each seat's strategy by name)
+//   - main.cc (chooses human or strategy per seat)
+//   - Tuner (evolves ParametricStrategy's parameters)
+
+export module Strategy;
+
+import <span>;
+import <string>;
+import <string_view>;
+import Player;
+import Building;
+import AcademicBuilding;
+import Board;
+
+// A trade offered to the player deciding. Each side is a square or cash.
+export struct TradeOffer {
+    const Building* gets = nullptr;   // square received (nullptr: cashIn instead)
+    int cashIn = 0;
+    const Building* gives = nullptr;  // square given up (nullptr: cashOut instead)
+    int cashOut = 0;
+};
+
+export class Strategy {
+public:
+    virtual ~Strategy() = default;
+
+    // The name used at setup and in save files (e.g. "always-buy").
+    virtual std::string_view name() const = 0;
+
+    // Buy b (unowned, just landed on) at its price? p may not be able to
+    // afford it; the controller then auctions it either way.
+    virtual bool buy(const Player& p, const Building& b, const Board& board) const = 0;
+
+    // The most p will pay for b at auction (0: pass). Clamped to p's cash.
+    virtual int maxBid(const Player& p, const Building& b, const Board& board) const = 0;
+
+    // Build one more improvement on ab? Only asked when p may (ab's block
+    // is a monopoly, unmortgaged, below 5 improvements, cost affordable).
+    virtual bool improve(const Player& p, const AcademicBuilding& ab, const Board& board) const = 0;
+
+    // Leave the Tims line with a Roll Up the Rim cup (default: yes).
+    virtual bool useRollUpCup(const Player& p, const Board& board) const;
+
+    // Pay $50 to leave the Tims line instead of rolling (default: yes).
+    virtual bool payTimsFine(const Player& p, const Board& board) const;
+
+    // Pay Tuition as 10% of total worth rather than $300 (default: the
+    // cheaper of the two).
+    virtual bool payTuitionPercent(const Player& p) const;
+
+    // Accept a trade (default: when it gains list-price value and does not
+    // give up a square of a completed block).
+    virtual bool acceptTrade(const Player& p, const TradeOffer& offer, const Board& board) const;
+};
+
+export class AlwaysBuyStrategy : public Strategy {
+public:
+    std::string_view name() const override;
+    bool buy(const Player& p, const Building& b, const Board& board) const override;
+    int maxBid(const Player& p, const Building& b, const Board& board) const override;
+    bool improve(const Player& p, const AcademicBuilding& ab, const Board& board) const override;
+};
+
+// Values squares by what they do for blocks: one that completes a block
+// is worth premium times its price; one in a block another player has
+// started but cannot complete without it is worth its price (denial).
+export class BlockFocusedStrategy : public Strategy {
+public:
+    explicit BlockFocusedStrategy(double premium = 1.5, int reserve = 100);
+
+    std::string_view name() const override;
+    bool buy(const Player& p, const Building& b, const Board& board) const override;
+    int maxBid(const Player& p, const Building& b, const Board& board) const override;
+    bool improve(const Player& p, const AcademicBuilding& ab, const Board& board) const override;
+    bool acceptTrade(const Player& p, const TradeOffer& offer, const Board& board) const override;
+
+private:
+    double premium;
+    int reserve;  // cash kept after any purchase
+};
+
+// Never lets a decision take its cash below reserve; waits out the Tims
+// line rather than paying.
+export class CashConservativeStrategy : public Strategy {
+public:
+    explicit CashConservativeStrategy(int reserve = 500);
+
+    std::string_view name() const override;
+    bool buy(const Player& p, const Building& b, const Board& board) const override;
+    int maxBid(const Player& p, const Building& b, const Board& board) const override;
+    bool improve(const Player& p, const AcademicBuilding& ab, const Board& board) const override;
+    bool payTimsFine(const Player& p, const Board& board) const override;
+    bool acceptTrade(const Player& p, const TradeOffer& offer, const Board& board) const override;
+
+private:
+    int reserve;
+};
+
+// Return = rent the square would charge once bought (counting the block,
+// residences or gyms p would then hold; gyms at an average roll of 7) per
+// dollar paid. Buys, bids and builds while that reaches threshold.
+export class RoiThresholdStrategy : public Strategy {
+public:
+    explicit RoiThresholdStrategy(double threshold = 0.1, int reserve = 150);
+
+    std::string_view name() const override;
+    bool buy(const Player& p, const Building& b, const Board& board) const override;
+    int maxBid(const Player& p, const Building& b, const Board& board) const override;
+    bool improve(const Player& p, const AcademicBuilding& ab, const Board& board) const override;
+
+private:
+    double threshold;
+    int reserve;
+};
+
+// The genome of a ParametricStrategy.
+export struct StrategyParams {
+    double buyThreshold = 0.08;      // least rent per dollar of price worth buying
+    double improveThreshold = 0.1;   // least rent gained per dollar of improvement
+    int cashReserve = 200;           // cash kept after buying, building or paying the fine
+    double bidFraction = 1.0;        // auction maximum as a fraction of the price
+
+    bool operator==(const StrategyParams&) const = default;
+};
+
+// Every rule a parameter: buys like RoiThresholdStrategy with buyThreshold,
+// builds when an improvement's rent gain per dollar reaches
+// improveThreshold, bids bidFraction of the price, and pays the Tims fine
+// only above its reserve.
+export class ParametricStrategy : public Strategy {
+public:
+    explicit ParametricStrategy(const StrategyParams& params = {});
+
+    // "tuned:<buyThreshold>,<improveThreshold>,<cashReserve>,<bidFraction>"
+    std::string_view name() const override;
+    const StrategyParams& params() const;
+
+    bool buy(const Player& p, const Building& b, const Board& board) const override;
+    int maxBid(const Player& p, const Building& b, const Board& board) const override;
+    bool improve(const Player& p, const AcademicBuilding& ab, const Board& board) const override;
+    bool payTimsFine(const Player& p, const Board& board) const override;
+
+private:
+    StrategyParams genome;
+    std::string label;
+};
+
+// Rent the square at position would charge if p owned it (see
+// RoiThresholdStrategy).
+export int rentIfOwned(const Player& p, int position, const Board& board);
+
+// The built-in strategies with default parameters, in the order above.
+export std::span<const Strategy* const> builtinStrategies();
+
+// Built-in strategy by name, or a ParametricStrategy for a "tuned:..."
+// name (one shared instance per parameter set); nullptr otherwise
+// (including for "human").
+export const Strategy* findStrategy(std::string_view name);
@@ -0,0 +1,27 @@
+// Test-Check.cc (interface)
+// Module: TestCheck
+// Description:
+//   The assertion line the test programs print, "[ASSERT] <label> [PASS]"
+//   or "... [FAIL]", so a run can be scanned (or grepped) for failures.
+//   Not part of the game: the Makefile links it into the test-* programs
+//   only.
+//
+// Related Modules:
+//   - the test-*.cc programs
+
+export module TestCheck;
+
+import <iostream>;
+import <string>;
+
+// "[ASSERT] label [PASS]" when ok, "[FAIL]" otherwise.
+export void check(const std::string& label, bool ok) {
+    std::cout << "[ASSERT] " << label << (ok ? " [PASS]" : " [FAIL]") << "\n";
+}
+
+// "[ASSERT] label: <actual> [PASS]", or "[FAIL] expected <expected>",
+// with unit (e.g. "$") in front of both numbers.
+export void check(const std::string& label, int actual, int expected, const std::string& unit = "") {
+    std::cout << "[ASSERT] " << label << ": " << unit << actual
+              << (actual == expected ? " [PASS]" : " [FAIL] expected " + unit + std::to_string(expected)) << "\n";
+}
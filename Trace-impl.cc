@@ -0,0 +1,127 @@
+// Trace-impl.cc (implementation)
+// Module: Trace
+// Description:
+//   Per-thread span buffers, their registry, and the JSON writer.
+//
+//   Output: {"displayTimeUnit":"ns","traceEvents":[...]} with one
+//   thread_name metadata event per thread, then one complete event per span:
+//     {"name":"roll","cat":"phase","ph":"X","ts":<us>,"dur":<us>,
+//      "pid":1,"tid":<thread>,"args":{"game":<id>}}
+//   Times are microseconds (to the nanosecond) since start().
+
+module Trace;
+
+import <cstdlib>;
+import <fstream>;
+import <iomanip>;
+import <iostream>;
+import <memory>;
+import <mutex>;
+import <vector>;
+
+namespace {
+
+struct Span {
+    const char* name;
+    const char* category;
+    std::uint64_t start;
+    std::uint64_t end;
+    std::uint32_t game;
+};
+
+struct ThreadBuffer {
+    int tid = 0;
+    std::vector<Span> spans;
+};
+
+std::mutex registryLock;                             // guards buffers, path, origin
+std::vector<std::unique_ptr<ThreadBuffer>> buffers;  // one per thread that recorded
+std::string tracePath;
+std::uint64_t origin = 0;                            // start() on the trace clock
+bool flushRegistered = false;
+std::atomic<std::uint32_t> nextGame{1};
+
+thread_local ThreadBuffer* localBuffer = nullptr;
+
+ThreadBuffer& threadBuffer() {
+    if (!localBuffer) {
+        std::lock_guard<std::mutex> lock{registryLock};
+        buffers.push_back(std::make_unique<ThreadBuffer>());
+        localBuffer = buffers.back().get();
+        localBuffer->tid = static_cast<int>(buffers.size());
+        localBuffer->spans.reserve(4096);
+    }
+    return *localBuffer;
+}
+
+void flushAtExit() {
+    Tracer::flush();
+}
+
+// Nanoseconds as microseconds with three decimals.
+void writeMicros(std::ostream& out, std::uint64_t ns) {
+    out << ns / 1000 << '.' << std::setw(3) << std::setfill('0') << ns % 1000;
+}
+
+}  // namespace
+
+void Tracer::start(const std::string& path) {
+    std::lock_guard<std::mutex> lock{registryLock};
+    tracePath = path;
+    origin = now();
+    if (!flushRegistered) {
+        std::atexit(flushAtExit);
+        flushRegistered = true;
+    }
+    active.store(true, std::memory_order_relaxed);
+}
+
+std::uint32_t Tracer::newGameId() {
+    return nextGame.fetch_add(1, std::memory_order_relaxed);
+}
+
+void Tracer::record(const char* name, const char* category, std::uint64_t start, std::uint64_t end) {
+    threadBuffer().spans.push_back({name, category, start, end, game});
+}
+
+void Tracer::stop() {
+    flush();
+    std::lock_guard<std::mutex> lock{registryLock};
+    active.store(false, std::memory_order_relaxed);
+    tracePath.clear();
+}
+
+void Tracer::flush() {
+    std::lock_guard<std::mutex> lock{registryLock};
+    if (tracePath.empty()) return;
+
+    std::ofstream out(tracePath);
+    if (!out) {
+        std::cerr << "Error writing to file: " << tracePath << "\n";
+        return;
+    }
+
+    out << "{\"displayTimeUnit\":\"ns\",\"traceEvents\":[\n";
+    bool first = true;
+    auto separator = [&] {
+        if (!first) out << ",\n";
+        first = false;
+    };
+    for (const auto& buffer : buffers) {
+        separator();
+        out << "{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":1,\"tid\":" << buffer->tid
+            << ",\"args\":{\"name\":\"thread " << buffer->tid << "\"}}";
+        for (const Span& span : buffer->spans) {
+            std::uint64_t start = span.start > origin ? span.start - origin : 0;
+            separator();
+            out << "{\"name\":\"" << span.name << "\",\"cat\":\"" << span.category
+                << "\",\"ph\":\"X\",\"ts\":";
+            writeMicros(out, start);
+            out << ",\"dur\":";
+            writeMicros(out, span.end - span.start);
+            out << ",\"pid\":1,\"tid\":" << buffer->tid
+                << ",\"args\":{\"game\":" << span.game << "}}";
+        }
+    }
+    out << "\n]}\n";
+}
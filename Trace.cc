@@ -0,0 +1,105 @@
+// Trace.cc (interface)
+// Module: Trace
+// Description:
+//   Optional execution tracer writing the Chrome/Perfetto trace-event JSON
+//   format (load the file in ui.perfetto.dev or chrome://tracing). It shows
+//   where each thread of a batch spends its time, slow turns, and the gaps
+//   between games.
+//
+//   Spans are complete ("X") events. GameController opens them around each
+//   turn, each turn phase, and its decision points (purchase prompts,
+//   auctions, raising funds), and new_Display around printGameBoard. Every
+//   span records its thread and the game being played on it. The game is
+//   a per-thread "current game" that the controller sets for the duration
+//   of its calls (TraceGameScope), so code below it needs no game handle.
+//
+//   Each thread appends to its own buffer, registered once on its first
+//   span; recording takes no lock. Buffers outlive their threads. They are
+//   written out by Tracer::flush(), which start() also registers to run at
+//   exit.
+//
+//   Tracing is off until Tracer::start(). While off, a span costs one
+//   relaxed atomic load.
+//
+// Related Modules:
+//   - GameController (turn, phase and decision spans; one game ID each)
+//   - new_Display (render spans)
+//   - main.cc ("-trace <file>")
+
+export module Trace;
+
+import <atomic>;
+import <chrono>;
+import <cstdint>;
+import <string>;
+
+export class Tracer {
+public:
+    // Starts recording; flush() (at the latest, at exit) writes to path.
+    static void start(const std::string& path);
+
+    // Writes every span recorded so far, from every thread, to the path
+    // given to start() (replacing the file). Call it while no other thread
+    // is recording, e.g. after the workers are joined. Does nothing if
+    // tracing was never started.
+    static void flush();
+
+    // flush(), then stops recording; nothing more is written at exit.
+    static void stop();
+
+    static inline bool enabled() { return active.load(std::memory_order_relaxed); }
+
+    // A fresh ID for a new game (1, 2, ...).
+    static std::uint32_t newGameId();
+
+    // The game played on this thread right now (0: none).
+    static inline std::uint32_t currentGame() { return game; }
+    static inline void setCurrentGame(std::uint32_t id) { game = id; }
+
+    // Nanoseconds on the trace clock.
+    static inline std::uint64_t now() {
+        return std::chrono::duration_cast<std::chrono::nanoseconds>(
+            std::chrono::steady_clock::now().time_since_epoch()).count();
+    }
+
+    // Appends a finished span to this thread's buffer.
+    static void record(const char* name, const char* category, std::uint64_t start, std::uint64_t end);
+
+private:
+    static inline std::atomic<bool> active{false};
+    static inline thread_local std::uint32_t game = 0;
+};
+
+// Makes id this thread's current game until the end of the scope.
+export class TraceGameScope {
+public:
+    inline explicit TraceGameScope(std::uint32_t id) : previous{Tracer::currentGame()} {
+        Tracer::setCurrentGame(id);
+    }
+    inline ~TraceGameScope() { Tracer::setCurrentGame(previous); }
+
+    TraceGameScope(const TraceGameScope&) = delete;
+    TraceGameScope& operator=(const TraceGameScope&) = delete;
+
+private:
+    std::uint32_t previous;
+};
+
+// Records the enclosing scope as a span. name and category must be string
+// literals (they are stored by pointer).
+export class TraceSpan {
+public:
+    inline TraceSpan(const char* name, const char* category)
+        : name{name}, category{category}, start{Tracer::enabled() ? Tracer::now() : 0} {}
+    inline ~TraceSpan() {
+        if (start) Tracer::record(name, category, start, Tracer::now());
+    }
+
+    TraceSpan(const TraceSpan&) = delete;
+    TraceSpan& operator=(const TraceSpan&) = delete;
+
+private:
+    const char* name;
+    const char* category;
+    std::uint64_t start;
+};
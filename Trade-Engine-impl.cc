@@ -0,0 +1,288 @@
+// Trade-Engine-impl.cc (implementation)
+// Module: TradeEngine
+// Description:
+//   Snapshots the board into flat per-square tables, precomputes every
+//   player's marginal value for every tradeable square, then fans player
+//   pairs out to worker threads that enumerate and prune candidates.
+
+module TradeEngine;
+
+import <algorithm>;
+import <atomic>;
+import <cmath>;
+import <thread>;
+import AcademicBuilding;
+import Building;
+import Residence;
+import Gym;
+import Square;
+import PropertySet;
+import BlockIndex;
+
+namespace {
+
+constexpr int Squares = 40;
+
+// Read-only view of everything the workers need; built once per call.
+struct Snapshot {
+    enum class Kind { None, Academic, Residence, Gym };
+
+    struct Info {
+        Kind kind = Kind::None;
+        int group = -1;          // academic block index, or the residence/gym group
+        int rent = 0;            // rent at current improvements, no monopoly
+        int monopolyRent = 0;    // same, with the monopoly doubling
+        bool mortgaged = false;
+        bool tradeable = false;  // ownable and its block has no improvements
+    };
+
+    std::vector<Info> squares = std::vector<Info>(Squares);
+    std::vector<PropertySet> groupMasks;
+    int residenceRent[5] = {};   // rent per residence when owning n
+    int gymRent[3] = {};         // expected rent per gym when owning n
+
+    struct Holder {
+        PropertySet owned;
+        int cash = 0;
+    };
+    std::vector<Holder> holders;
+    TradeWeights weights;
+
+    double cashValue(int cash) const {
+        double short_ = std::max(0, weights.cashFloor - cash);
+        return cash - weights.shortfallPenalty * short_;
+    }
+
+    // Value of one group's squares within `owned`.
+    double groupValue(const PropertySet& owned, int group) const {
+        const PropertySet mask = groupMasks[group];
+        const PropertySet mine = owned & mask;
+        if (mine.empty()) return 0;
+
+        int rent = 0;
+        double bonus = 0;
+        const Info& first = squares[*mask.begin()];
+        if (first.kind == Kind::Academic) {
+            bool monopoly = mine == mask;
+            for (int s : mine) {
+                if (!squares[s].mortgaged) rent += monopoly ? squares[s].monopolyRent : squares[s].rent;
+            }
+            if (monopoly) bonus = weights.monopolyBonus;
+        } else {
+            int n = mine.size();
+            for (int s : mine) {
+                if (squares[s].mortgaged) continue;
+                rent += first.kind == Kind::Residence ? residenceRent[std::min(n, 4)] : gymRent[std::min(n, 2)];
+            }
+        }
+        return weights.rentHorizon * rent + bonus;
+    }
+
+    // Change in value when `owned` loses `out` and gains `in` (-1 = none).
+    double delta(const PropertySet& owned, int out, int in) const {
+        PropertySet after = owned;
+        if (out >= 0) after.erase(out);
+        if (in >= 0) after.insert(in);
+
+        int g1 = out >= 0 ? squares[out].group : -1;
+        int g2 = in >= 0 ? squares[in].group : -1;
+        double d = 0;
+        if (g1 >= 0) d += groupValue(after, g1) - groupValue(owned, g1);
+        if (g2 >= 0 && g2 != g1) d += groupValue(after, g2) - groupValue(owned, g2);
+        return d;
+    }
+};
+
+Snapshot takeSnapshot(const Board& board, const std::vector<const Player*>& players,
+                      const TradeWeights& weights) {
+    Snapshot snap;
+    snap.weights = weights;
+
+    // Groups: one per monopoly block (same IDs as the board's BlockIndex),
+    // then all residences, then all gyms.
+    const BlockIndex& blocks = board.getBlocks();
+    const int residenceGroup = blocks.size();
+    const int gymGroup = residenceGroup + 1;
+    for (int b = 0; b < blocks.size(); ++b) snap.groupMasks.push_back(blocks.members(b));
+    snap.groupMasks.push_back(board.getResidences());
+    snap.groupMasks.push_back(board.getGyms());
+
+    for (int i = 0; i < Squares; ++i) {
+        Square* sq = board.getSquare(i);
+        auto& info = snap.squares[i];
+
+        if (auto* ab = dynamic_cast<AcademicBuilding*>(sq)) {
+            info.kind = Snapshot::Kind::Academic;
+            info.group = ab->getBlockId();
+            info.rent = ab->rentAtLevel(ab->getImprovementCount(), false);
+            info.monopolyRent = ab->rentAtLevel(ab->getImprovementCount(), true);
+            info.tradeable = blocks.improvements(info.group) == 0;
+        } else if (auto* res = dynamic_cast<Residence*>(sq)) {
+            info.kind = Snapshot::Kind::Residence;
+            info.group = residenceGroup;
+            info.tradeable = true;
+            for (int n = 1; n <= 4; ++n) snap.residenceRent[n] = res->calculateRent(n);
+        } else if (auto* gym = dynamic_cast<Gym*>(sq)) {
+            info.kind = Snapshot::Kind::Gym;
+            info.group = gymGroup;
+            info.tradeable = true;
+            for (int n = 1; n <= 2; ++n) snap.gymRent[n] = gym->getMultiplier(n) * 7;  // expected dice total
+        } else {
+            continue;
+        }
+
+        info.mortgaged = static_cast<Building*>(sq)->isMortgaged();
+    }
+    for (const Player* p : players) {
+        snap.holders.push_back({p->getProperties(), p->getMoney()});
+    }
+    return snap;
+}
+
+// Smallest cash payment that makes giving up `loss` of value worthwhile
+// for a seller holding `cash` (their cash value rises faster below the floor).
+int askingPrice(const Snapshot& snap, int cash, double loss) {
+    if (loss <= 0) return 1;
+    const double slope = 1.0 + snap.weights.shortfallPenalty;
+    const double belowFloor = std::max(0, snap.weights.cashFloor - cash);
+    if (loss <= belowFloor * slope) return std::max(1, static_cast<int>(std::ceil(loss / slope)));
+    return static_cast<int>(belowFloor + std::ceil(loss - belowFloor * slope));
+}
+
+struct PairWork {
+    int a;
+    int b;
+};
+
+// All candidates between players a and b (both directions).
+void evaluatePair(const Snapshot& snap, const std::vector<const Player*>& players,
+                  const std::vector<std::vector<double>>& gain,
+                  const std::vector<std::vector<double>>& loss,
+                  PairWork pair, std::vector<TradeCandidate>& out) {
+    const auto& A = snap.holders[pair.a];
+    const auto& B = snap.holders[pair.b];
+
+    auto tradeable = [&](const PropertySet& set) {
+        std::vector<int> list;
+        for (int s : set) if (snap.squares[s].tradeable) list.push_back(s);
+        return list;
+    };
+    std::vector<int> aProps = tradeable(A.owned);
+    std::vector<int> bProps = tradeable(B.owned);
+
+    // Counterpart squares in decreasing order of what they are worth to the taker.
+    auto byGainFor = [&](int taker, std::vector<int> list) {
+        std::sort(list.begin(), list.end(), [&](int x, int y) {
+            return gain[taker][x] != gain[taker][y] ? gain[taker][x] > gain[taker][y] : x < y;
+        });
+        return list;
+    };
+    const std::vector<int> bForA = byGainFor(pair.a, bProps);
+    const std::vector<int> aForB = byGainFor(pair.b, aProps);
+
+    // === Property-for-property (a from A, b from B) ===
+    for (int a : aProps) {
+        const int ga = snap.squares[a].group;
+        auto consider = [&](int b) {
+            double fromGain = snap.delta(A.owned, a, b);
+            if (fromGain < 0) return;
+            double toGain = snap.delta(B.owned, b, a);
+            if (toGain < 0 || fromGain + toGain <= 0) return;
+            out.push_back({players[pair.a], players[pair.b], a, b, 0, fromGain, toGain});
+        };
+
+        // Squares in a's own group interact with it; evaluate them exactly.
+        for (int b : bProps) {
+            if (snap.squares[b].group == ga) consider(b);
+        }
+        // Elsewhere the gain is separable: stop once b can't cover losing a.
+        for (int b : bForA) {
+            if (gain[pair.a][b] < loss[pair.a][a]) break;
+            if (snap.squares[b].group != ga) consider(b);
+        }
+    }
+
+    // === Cash for property, both directions ===
+    auto cashPurchases = [&](int buyer, int seller, const std::vector<int>& sorted) {
+        const auto& Buyer = snap.holders[buyer];
+        const auto& Seller = snap.holders[seller];
+        for (int s : sorted) {
+            if (gain[buyer][s] <= 0) break;  // sorted: nothing further is worth buying
+            int price = askingPrice(snap, Seller.cash, loss[seller][s]);
+            if (price > Buyer.cash || price >= gain[buyer][s]) continue;
+
+            double buyerGain = gain[buyer][s] + snap.cashValue(Buyer.cash - price) - snap.cashValue(Buyer.cash);
+            double sellerGain = -loss[seller][s] + snap.cashValue(Seller.cash + price) - snap.cashValue(Seller.cash);
+            if (buyerGain < 0 || sellerGain < 0 || buyerGain + sellerGain <= 0) continue;
+            // Buyer pays cash and receives s.
+            out.push_back({players[buyer], players[seller], -1, s, price, buyerGain, sellerGain});
+        }
+    };
+    cashPurchases(pair.a, pair.b, bForA);
+    cashPurchases(pair.b, pair.a, aForB);
+}
+
+}  // namespace
+
+std::vector<TradeCandidate> evaluateTrades(const Board& board,
+                                           const std::vector<const Player*>& players,
+                                           const TradeWeights& weights) {
+    const Snapshot snap = takeSnapshot(board, players, weights);
+    const int n = static_cast<int>(players.size());
+
+    // Marginal value of each square for each player: gain if acquired alone,
+    // loss if given away alone.
+    std::vector<std::vector<double>> gain(n, std::vector<double>(Squares, 0));
+    std::vector<std::vector<double>> loss(n, std::vector<double>(Squares, 0));
+    for (int p = 0; p < n; ++p) {
+        for (int s = 0; s < Squares; ++s) {
+            if (!snap.squares[s].tradeable) continue;
+            if (snap.holders[p].owned.contains(s)) loss[p][s] = -snap.delta(snap.holders[p].owned, s, -1);
+            else gain[p][s] = snap.delta(snap.holders[p].owned, -1, s);
+        }
+    }
+
+    std::vector<PairWork> work;
+    for (int a = 0; a < n; ++a) {
+        for (int b = a + 1; b < n; ++b) work.push_back({a, b});
+    }
+
+    unsigned threads = weights.threads ? weights.threads : std::thread::hardware_concurrency();
+    threads = std::max(1u, std::min<unsigned>(threads, work.size()));
+
+    std::vector<std::vector<TradeCandidate>> results(threads);
+    std::atomic<std::size_t> next{0};
+    auto worker = [&](unsigned id) {
+        for (std::size_t i; (i = next.fetch_add(1, std::memory_order_relaxed)) < work.size();) {
+            evaluatePair(snap, players, gain, loss, work[i], results[id]);
+        }
+    };
+
+    std::vector<std::thread> pool;
+    for (unsigned t = 1; t < threads; ++t) pool.emplace_back(worker, t);
+    worker(0);
+    for (auto& t : pool) t.join();
+
+    std::vector<TradeCandidate> all;
+    for (auto& r : results) all.insert(all.end(), r.begin(), r.end());
+
+    auto index = [&](const Player* p) {
+        return std::find(players.begin(), players.end(), p) - players.begin();
+    };
+    std::sort(all.begin(), all.end(), [&](const TradeCandidate& x, const TradeCandidate& y) {
+        if (x.score() != y.score()) return x.score() > y.score();
+        if (x.from != y.from) return index(x.from) < index(y.from);
+        if (x.to != y.to) return index(x.to) < index(y.to);
+        if (x.give != y.give) return x.give < y.give;
+        return x.receive < y.receive;
+    });
+    return all;
+}
+
+std::string tradeGiveString(const Board& board, const TradeCandidate& c) {
+    return c.give >= 0 ? board.getSquare(c.give)->getName() : std::to_string(c.cash);
+}
+
+std::string tradeReceiveString(const Board& board, const TradeCandidate& c) {
+    return c.receive >= 0 ? board.getSquare(c.receive)->getName() : std::to_string(c.cash);
+}
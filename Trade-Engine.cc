@@ -0,0 +1,66 @@
+// Trade-Engine.cc (interface)
+// Module: TradeEngine
+// Description:
+//   Batch trade evaluation for automated players. For a given game state it
+//   enumerates every property-for-property swap and cash-for-property
+//   purchase between each pair of players, scores both sides, and returns
+//   the trades that leave neither side worse off, best first.
+//
+//   A player's position is valued as
+//       rentHorizon * (rent their unmortgaged squares charge now)
+//     + monopolyBonus per completed block          (cf. hasMonopoly)
+//     + cash, minus shortfallPenalty per dollar below cashFloor
+//   and a trade's score for a side is the change in that value.
+//
+//   Cost per candidate is O(1): the board is snapshotted once, rent only
+//   changes inside the blocks a trade touches, and each player's marginal
+//   gain/loss for every square is precomputed. Candidates are pruned early
+//   by walking the counterpart's squares in decreasing marginal value and
+//   stopping once no remaining square can pay for what is given up. Player
+//   pairs are spread across worker threads; the board is never touched by
+//   the workers.
+//
+//   Trades follow GameController::trade's rules: squares in a block with
+//   improvements are not offered, and money is never traded for money.
+//
+// Related Modules:
+//   - GameController (evaluateTrades() wraps this; trade() executes one)
+//   - Board, Player, PropertySet (read-only inputs)
+
+export module TradeEngine;
+
+import <string>;
+import <vector>;
+import Board;
+import Player;
+
+export struct TradeWeights {
+    double rentHorizon = 8.0;       // opponent visits a square's rent is worth
+    int monopolyBonus = 200;        // value of completing a block
+    int cashFloor = 150;            // cash kept back for rent and fees
+    double shortfallPenalty = 1.0;  // extra cost per dollar below cashFloor
+    unsigned threads = 0;           // 0 = hardware concurrency
+};
+
+// One proposal. A side gives either a square (position >= 0) or cash.
+export struct TradeCandidate {
+    const Player* from = nullptr;
+    const Player* to = nullptr;
+    int give = -1;       // square from gives, or -1 when from pays cash
+    int receive = -1;    // square from receives, or -1 when to pays cash
+    int cash = 0;        // amount paid by whichever side gives no square
+    double fromGain = 0;
+    double toGain = 0;
+
+    double score() const { return fromGain + toGain; }
+};
+
+// Evaluates every pair among players (in the order given). Results are
+// sorted by score, then deterministically by players and squares.
+export std::vector<TradeCandidate> evaluateTrades(const Board& board,
+                                                  const std::vector<const Player*>& players,
+                                                  const TradeWeights& weights = {});
+
+// The give/receive strings GameController::trade expects for c.
+export std::string tradeGiveString(const Board& board, const TradeCandidate& c);
+export std::string tradeReceiveString(const Board& board, const TradeCandidate& c);
@@ -0,0 +1,202 @@
+// Tuner-impl.cc (implementation)
+// Module: Tuner
+// Description:
+//   Game scoring, the parallel population evaluation, and the GA:
+//   elitism, tournament selection (3), uniform crossover and a Gaussian
+//   step on every gene, clamped to its range and rounded to its grid (so
+//   the "tuned:..." name of a result reads back exactly).
+
+module Tuner;
+
+import <algorithm>;
+import <array>;
+import <atomic>;
+import <chrono>;
+import <cmath>;
+import <iostream>;
+import <numeric>;
+import <random>;
+import <string>;
+import <thread>;
+import Game;
+import GameController;
+import Player;
+
+namespace {
+
+const char* const seatTokens[] = {"G", "B", "D", "P"};
+constexpr int Seats = 4;
+
+// Range and grid of one gene. The grid is given as steps per unit, so a
+// grid point is an integer divided by an integer: the same double that
+// reading its printed decimal gives back (k * 0.001 often is not).
+struct Gene {
+    double low;
+    double high;
+    double stepsPerUnit;
+};
+
+constexpr std::array<Gene, 4> genes = {{
+    {0.0, 0.25, 1000},    // buyThreshold
+    {0.0, 0.5, 1000},     // improveThreshold
+    {0.0, 1000.0, 1},     // cashReserve
+    {0.2, 2.0, 100},      // bidFraction
+}};
+
+std::array<double, 4> toGenes(const StrategyParams& p) {
+    return {p.buyThreshold, p.improveThreshold, static_cast<double>(p.cashReserve), p.bidFraction};
+}
+
+StrategyParams fromGenes(std::array<double, 4> g) {
+    for (std::size_t i = 0; i < genes.size(); ++i) {
+        g[i] = std::clamp(g[i], genes[i].low, genes[i].high);
+        g[i] = std::round(g[i] * genes[i].stepsPerUnit) / genes[i].stepsPerUnit;
+    }
+    return {g[0], g[1], static_cast<int>(g[2]), g[3]};
+}
+
+const std::vector<const Strategy*>& opponentsOf(const TunerConfig& config) {
+    static const std::vector<const Strategy*> builtins(builtinStrategies().begin(), builtinStrategies().end());
+    return config.opponents.empty() ? builtins : config.opponents;
+}
+
+}  // namespace
+
+double playTuningGame(const Strategy& candidate, const TunerConfig& config, int game, unsigned seed) {
+    const std::vector<const Strategy*>& opponents = opponentsOf(config);
+    Game table;
+    GameController& controller = table.getController();
+    int seat = game % Seats;
+    for (int i = 0, next = game; i < Seats; ++i) {
+        Player* p = table.addPlayer("Seat" + std::to_string(i + 1), seatTokens[i]);
+        controller.setStrategy(p, i == seat ? &candidate : opponents[next++ % opponents.size()]);
+    }
+    controller.setAuctionMode(AuctionMode::ProxyEnglish);
+    controller.seed(seed);
+
+    int active = Seats;
+    for (int round = 0; round < config.maxRounds && active > 1; ++round) {
+        for (int i = 0; i < Seats && active > 1; ++i) {
+            Player* p = table.getPlayer(i);
+            if (p->isBankrupt()) continue;
+            controller.playBotTurn(p);
+            active = 0;
+            for (int j = 0; j < Seats; ++j) active += !table.getPlayer(j)->isBankrupt();
+        }
+    }
+
+    const Player* me = table.getPlayer(seat);
+    if (me->isBankrupt()) return 0.0;
+    if (active == 1) return 1.0;
+    double total = 0;
+    for (int j = 0; j < Seats; ++j) {
+        const Player* p = table.getPlayer(j);
+        if (!p->isBankrupt()) total += std::max(0, p->getNetWorth());
+    }
+    return total > 0 ? std::max(0, me->getNetWorth()) / total : 0.0;
+}
+
+std::vector<double> evaluatePopulation(const std::vector<StrategyParams>& population,
+                                       const TunerConfig& config, unsigned firstSeed) {
+    std::vector<ParametricStrategy> candidates(population.begin(), population.end());
+    const std::size_t games = static_cast<std::size_t>(std::max(config.games, 1));
+    const std::size_t items = candidates.size() * games;
+    std::vector<double> scores(items);
+
+    unsigned threads = config.threads ? config.threads : std::thread::hardware_concurrency();
+    threads = static_cast<unsigned>(std::max<std::size_t>(1, std::min<std::size_t>(threads, items)));
+
+    // Item i is game i % games of candidate i / games; every candidate
+    // plays the same seeds.
+    std::atomic<std::size_t> next{0};
+    auto worker = [&] {
+        for (std::size_t i; (i = next.fetch_add(1, std::memory_order_relaxed)) < items;) {
+            int game = static_cast<int>(i % games);
+            scores[i] = playTuningGame(candidates[i / games], config, game, firstSeed + game);
+        }
+    };
+
+    // The games' console output goes nowhere while they run.
+    std::ios_base::iostate coutState = std::cout.rdstate();
+    std::cout.setstate(std::ios::failbit);
+    std::vector<std::thread> pool;
+    for (unsigned t = 1; t < threads; ++t) pool.emplace_back(worker);
+    worker();
+    for (auto& t : pool) t.join();
+    std::cout.clear(coutState);
+
+    std::vector<double> fitness(candidates.size());
+    for (std::size_t c = 0; c < candidates.size(); ++c) {
+        fitness[c] = std::accumulate(scores.begin() + c * games, scores.begin() + (c + 1) * games, 0.0) / games;
+    }
+    return fitness;
+}
+
+StrategyParams tuneStrategy(const TunerConfig& config,
+                            const std::function<void(const GenerationReport&)>& report) {
+    std::mt19937 rng{config.seed};
+    const int size = std::max(config.population, 2);
+    const int elite = std::clamp(config.elite, 0, size - 1);
+
+    // The hand-set defaults, and random points across the ranges.
+    std::vector<StrategyParams> population{StrategyParams{}};
+    while (static_cast<int>(population.size()) < size) {
+        std::array<double, 4> g;
+        for (std::size_t i = 0; i < genes.size(); ++i) {
+            g[i] = std::uniform_real_distribution<double>{genes[i].low, genes[i].high}(rng);
+        }
+        population.push_back(fromGenes(g));
+    }
+
+    StrategyParams best = population.front();
+    for (int generation = 0; generation < std::max(config.generations, 1); ++generation) {
+        unsigned firstSeed = config.seed * 100003u + static_cast<unsigned>(generation * config.games);
+        auto start = std::chrono::steady_clock::now();
+        std::vector<double> fitness = evaluatePopulation(population, config, firstSeed);
+        auto end = std::chrono::steady_clock::now();
+
+        std::vector<int> order(size);
+        std::iota(order.begin(), order.end(), 0);
+        std::stable_sort(order.begin(), order.end(), [&](int a, int b) { return fitness[a] > fitness[b]; });
+        best = population[order.front()];
+
+        if (report) {
+            GenerationReport r;
+            r.generation = generation;
+            r.best = best;
+            r.bestFitness = fitness[order.front()];
+            r.meanFitness = std::accumulate(fitness.begin(), fitness.end(), 0.0) / size;
+            r.games = static_cast<long long>(size) * config.games;
+            r.seconds = std::chrono::duration<double>(end - start).count();
+            report(r);
+        }
+        if (generation + 1 == config.generations) break;
+
+        // Next generation: the elite as they are, then children.
+        auto tournament = [&] {
+            std::uniform_int_distribution<int> pick{0, size - 1};
+            int winner = pick(rng);
+            for (int k = 1; k < 3; ++k) {
+                int challenger = pick(rng);
+                if (fitness[challenger] > fitness[winner]) winner = challenger;
+            }
+            return toGenes(population[winner]);
+        };
+        std::vector<StrategyParams> children;
+        for (int i = 0; i < elite; ++i) children.push_back(population[order[i]]);
+        std::normal_distribution<double> step{0.0, 1.0};
+        std::bernoulli_distribution coin{0.5};
+        while (static_cast<int>(children.size()) < size) {
+            std::array<double, 4> mother = tournament();
+            std::array<double, 4> father = tournament();
+            std::array<double, 4> child;
+            for (std::size_t i = 0; i < genes.size(); ++i) {
+                child[i] = (coin(rng) ? mother[i] : father[i]) +
+                           step(rng) * config.mutation * (genes[i].high - genes[i].low);
+            }
+            children.push_back(fromGenes(child));
+        }
+        population = std::move(children);
+    }
+    return best;
+}
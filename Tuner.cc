@@ -0,0 +1,70 @@
+// Tuner.cc (interface)
+// Module: Tuner
+// Description:
+//   Evolves ParametricStrategy's parameters (StrategyParams: buy and
+//   improvement thresholds, cash reserve, auction bid fraction) with a
+//   genetic algorithm, scoring each candidate by playing seeded games on
+//   the engine.
+//
+//   A candidate's fitness is its mean score over `games` four-seat games
+//   against the opponent strategies (1 for winning, 0 for going bankrupt,
+//   otherwise its share of the table's net worth once maxRounds rounds are
+//   up). Games use proxy English auctions, so nothing is ever asked on
+//   std::cin.
+//
+//   Variance reduction: within a generation every candidate plays the
+//   same games, i.e. the same seeds from the same seats against the same
+//   opponents (common random numbers). Differences in fitness are then
+//   mostly differences in play rather than dice. Each generation draws
+//   fresh seeds, so the search does not overfit one set of games.
+//
+//   Throughput: the (candidate, game) pairs of a generation are spread
+//   over worker threads, each game in its own Game (its own arena, no
+//   shared mutable state), and console output is switched off while a
+//   generation runs. Results do not depend on the number of threads.
+//
+// Related Modules:
+//   - Strategy (ParametricStrategy, and the opponents)
+//   - Game, GameController (the games played)
+//   - tune.cc (command-line front end)
+
+export module Tuner;
+
+import <functional>;
+import <vector>;
+import Strategy;
+
+export struct TunerConfig {
+    int population = 24;
+    int generations = 30;
+    int games = 64;            // games per candidate per generation
+    int maxRounds = 200;       // then the game is scored on net worth
+    int elite = 2;             // best candidates carried over unchanged
+    double mutation = 0.15;    // mutation step, as a fraction of each gene's range
+    unsigned seed = 1;         // the GA's own RNG and the game seeds
+    unsigned threads = 0;      // 0 = hardware concurrency
+    std::vector<const Strategy*> opponents;  // seated in turn beside the candidate; empty: the built-ins
+};
+
+export struct GenerationReport {
+    int generation = 0;
+    StrategyParams best;
+    double bestFitness = 0;
+    double meanFitness = 0;
+    long long games = 0;       // games played this generation
+    double seconds = 0;        // wall time spent playing them
+};
+
+// Score of one game for candidate (see above). Game g of a generation
+// seats the candidate at g % 4 and seeds the dice with seed.
+export double playTuningGame(const Strategy& candidate, const TunerConfig& config, int game, unsigned seed);
+
+// Fitness of each candidate, all playing games 0..config.games-1 with
+// seeds firstSeed, firstSeed + 1, ...
+export std::vector<double> evaluatePopulation(const std::vector<StrategyParams>& population,
+                                              const TunerConfig& config, unsigned firstSeed);
+
+// Runs the GA and returns the best parameters of the last generation.
+// report (if given) is called once per generation.
+export StrategyParams tuneStrategy(const TunerConfig& config,
+                                   const std::function<void(const GenerationReport&)>& report = {});
@@ -0,0 +1,122 @@
+// Turn-Stats-impl.cc (implementation)
+// Module: TurnStats
+// Description:
+//   Histogram bucketing, percentiles and the stats table.
+
+module TurnStats;
+
+import <bit>;
+import <iomanip>;
+
+namespace {
+
+// Bucket for a sample: the value itself below 16, otherwise 8 linear
+// sub-buckets per power of two (top three bits below the leading one).
+int bucketOf(std::uint64_t ns) {
+    if (ns < 16) return static_cast<int>(ns);
+    int exponent = std::bit_width(ns) - 1;  // >= 4
+    int sub = static_cast<int>((ns >> (exponent - 3)) & 7);
+    return 16 + (exponent - 4) * 8 + sub;
+}
+
+// Midpoint of the values that fall in a bucket.
+std::uint64_t bucketValue(int bucket) {
+    if (bucket < 16) return bucket;
+    int exponent = (bucket - 16) / 8 + 4;
+    std::uint64_t sub = (bucket - 16) % 8;
+    std::uint64_t width = std::uint64_t{1} << (exponent - 3);
+    return (std::uint64_t{1} << exponent) + sub * width + width / 2;
+}
+
+}  // namespace
+
+const char* statPhaseName(StatPhase phase) {
+    switch (phase) {
+        case StatPhase::Turn:    return "turn";
+        case StatPhase::Roll:    return "roll";
+        case StatPhase::Jail:    return "jail";
+        case StatPhase::Move:    return "move";
+        case StatPhase::Land:    return "onLand";
+        case StatPhase::Rent:    return "rent";
+        case StatPhase::Payment: return "payment";
+        case StatPhase::Auction: return "auction";
+        case StatPhase::Render:  return "render";
+        case StatPhase::Count:   break;
+    }
+    return "?";
+}
+
+void LatencyHistogram::record(std::uint64_t ns) {
+    int bucket = bucketOf(ns);
+    if (bucket >= Buckets) bucket = Buckets - 1;
+    ++buckets[bucket];
+    ++samples;
+    sum += ns;
+    if (ns > largest) largest = ns;
+}
+
+std::uint64_t LatencyHistogram::count() const {
+    return samples;
+}
+
+std::uint64_t LatencyHistogram::max() const {
+    return largest;
+}
+
+std::uint64_t LatencyHistogram::total() const {
+    return sum;
+}
+
+std::uint64_t LatencyHistogram::percentile(double q) const {
+    if (samples == 0) return 0;
+    // Rank of the sample at q (1-based), clamped to [1, samples].
+    std::uint64_t rank = static_cast<std::uint64_t>(q * samples + 0.5);
+    if (rank < 1) rank = 1;
+    if (rank > samples) rank = samples;
+
+    std::uint64_t seen = 0;
+    for (int b = 0; b < Buckets; ++b) {
+        seen += buckets[b];
+        if (seen >= rank) {
+            std::uint64_t value = bucketValue(b);
+            return value < largest ? value : largest;
+        }
+    }
+    return largest;
+}
+
+void TurnStats::record(StatPhase phase, std::uint64_t ns) {
+    phases[static_cast<int>(phase)].record(ns);
+}
+
+const LatencyHistogram& TurnStats::histogram(StatPhase phase) const {
+    return phases[static_cast<int>(phase)];
+}
+
+void TurnStats::reset() {
+    phases = {};
+}
+
+void TurnStats::print(std::ostream& out) const {
+    if (!turnStatsEnabled) {
+        out << "[Stats] Turn timing is not compiled in (rebuild with: make TURN_STATS=1).\n";
+        return;
+    }
+
+    std::ios_base::fmtflags flags = out.flags();
+    std::streamsize precision = out.precision();
+    out << std::left << std::setw(10) << "phase" << std::right
+        << std::setw(10) << "count" << std::setw(12) << "p50 ns"
+        << std::setw(12) << "p99 ns" << std::setw(12) << "max ns"
+        << std::setw(14) << "total ms" << "\n";
+    for (int i = 0; i < static_cast<int>(StatPhase::Count); ++i) {
+        const LatencyHistogram& h = phases[i];
+        if (h.count() == 0) continue;
+        out << std::left << std::setw(10) << statPhaseName(static_cast<StatPhase>(i)) << std::right
+            << std::setw(10) << h.count() << std::setw(12) << h.percentile(0.5)
+            << std::setw(12) << h.percentile(0.99) << std::setw(12) << h.max()
+            << std::setw(14) << std::fixed << std::setprecision(3) << h.total() / 1e6 << "\n";
+    }
+    out.flags(flags);
+    out.precision(precision);
+}
@@ -0,0 +1,121 @@
+// Turn-Stats.cc (interface)
+// Module: TurnStats
+// Description:
+//   Per-phase latency histograms for the turn pipeline. GameController
+//   times each phase of a turn (roll, jail handling, movement, onLand
+//   dispatch, rent, payment resolution, auctions) and main.cc times board
+//   rendering; each sample lands in a fixed log-linear histogram, so
+//   recording is a clock read, a bit scan and an increment, with no
+//   allocation. p50/p99 come from the histogram (within 1/8 of the value).
+//
+//   Phases nest: a rent phase includes the payment it triggers, and the
+//   Turn phase covers everything from beginTurn() to Done.
+//
+//   The instrumentation is compiled in only when the build defines
+//   WATOPOLY_TURN_STATS=1 (make TURN_STATS=1). Otherwise PhaseTimer is an
+//   empty type whose constructor does nothing, so the timers cost nothing
+//   and no clock is read; TurnStats then simply stays empty.
+//
+// Related Modules:
+//   - GameController (times the turn phases; see setTurnStats())
+//   - main.cc (times rendering; "stats" command and the dump at exit)
+
+module;
+
+#ifndef WATOPOLY_TURN_STATS
+#define WATOPOLY_TURN_STATS 0
+#endif
+
+export module TurnStats;
+
+import <array>;
+import <chrono>;
+import <cstdint>;
+import <ostream>;
+
+export inline constexpr bool turnStatsEnabled = WATOPOLY_TURN_STATS != 0;
+
+export enum class StatPhase : std::uint8_t {
+    Turn,      // a whole turn, beginTurn() to Done
+    Roll,
+    Jail,
+    Move,
+    Land,      // onLand() dispatch (and the SLC draw)
+    Rent,
+    Payment,   // enforcePayment(), including any liquidation
+    Auction,
+    Render,    // new_Display::printGameBoard (timed by main.cc)
+    Count
+};
+
+export const char* statPhaseName(StatPhase phase);
+
+// Counts of nanosecond samples in log-linear buckets: exact below 16 ns,
+// then 8 buckets per power of two.
+export class LatencyHistogram {
+public:
+    static constexpr int Buckets = 16 + 60 * 8;
+
+    void record(std::uint64_t ns);
+
+    std::uint64_t count() const;
+    std::uint64_t max() const;
+    std::uint64_t total() const;
+
+    // Value at quantile q (0..1): the midpoint of the bucket holding it.
+    std::uint64_t percentile(double q) const;
+
+private:
+    std::array<std::uint32_t, Buckets> buckets{};
+    std::uint64_t samples = 0;
+    std::uint64_t sum = 0;
+    std::uint64_t largest = 0;
+};
+
+export class TurnStats {
+public:
+    void record(StatPhase phase, std::uint64_t ns);
+    const LatencyHistogram& histogram(StatPhase phase) const;
+    void reset();
+
+    // One row per phase with samples: count, p50, p99, max and total.
+    void print(std::ostream& out) const;
+
+private:
+    std::array<LatencyHistogram, static_cast<int>(StatPhase::Count)> phases;
+};
+
+// Times a scope into a TurnStats (nullptr: nothing is recorded).
+export template <bool Enabled>
+class BasicPhaseTimer;
+
+template <>
+class BasicPhaseTimer<true> {
+public:
+    inline BasicPhaseTimer(TurnStats* stats, StatPhase phase)
+        : stats{stats}, phase{phase} {
+        if (stats) start = std::chrono::steady_clock::now();
+    }
+
+    inline ~BasicPhaseTimer() {
+        if (!stats) return;
+        auto elapsed = std::chrono::steady_clock::now() - start;
+        stats->record(phase, std::chrono::duration_cast<std::chrono::nanoseconds>(elapsed).count());
+    }
+
+    BasicPhaseTimer(const BasicPhaseTimer&) = delete;
+    BasicPhaseTimer& operator=(const BasicPhaseTimer&) = delete;
+
+private:
+    TurnStats* stats;
+    StatPhase phase;
+    std::chrono::steady_clock::time_point start;
+};
+
+template <>
+class BasicPhaseTimer<false> {
+public:
+    inline BasicPhaseTimer(TurnStats*, StatPhase) noexcept {}
+};
+
+export using PhaseTimer = BasicPhaseTimer<turnStatsEnabled>;
@@ -0,0 +1,182 @@
+// Win-Odds-impl.cc (implementation)
+// Module: WinOdds
+// Description:
+//   The rollout loop and the worker pool. A rollout owns its fork, so the
+//   only state the workers share is the position they fork from (read
+//   only) and the counters.
+
+module WinOdds;
+
+import <algorithm>;
+import <chrono>;
+import <cmath>;
+import <cstdint>;
+import <functional>;
+import <iomanip>;
+import <iostream>;
+import <memory>;
+import <sstream>;
+import <thread>;
+import <utility>;
+import GameController;
+import Strategy;
+
+namespace {
+
+using Clock = std::chrono::steady_clock;
+
+// The winner's turn-order index. `onNetWorth` is set when maxRounds or
+// the pool's deadline came first.
+int playRollout(Game& table, int first, const OddsConfig& config, const std::function<bool()>& expired,
+                bool& onNetWorth) {
+    GameController& controller = table.getController();
+    const int seats = table.playerCount();
+    auto standing = [&] {
+        int active = 0;
+        for (int i = 0; i < seats; ++i) active += !table.getPlayer(i)->isBankrupt();
+        return active;
+    };
+
+    int active = standing();
+    for (int round = 0; round < config.maxRounds && active > 1; ++round) {
+        if (expired()) break;
+        // The first round starts at `first`, like the game it was forked from.
+        for (int k = 0; k < seats && active > 1; ++k) {
+            Player* p = table.getPlayer((first + k) % seats);
+            if (p->isBankrupt()) continue;
+            controller.playBotTurn(p);
+            active = standing();
+        }
+    }
+
+    onNetWorth = active > 1;
+    int winner = -1;
+    for (int i = 0; i < seats; ++i) {
+        const Player* p = table.getPlayer(i);
+        if (p->isBankrupt()) continue;
+        if (winner < 0 || p->getNetWorth() > table.getPlayer(winner)->getNetWorth()) winner = i;
+    }
+    return winner;
+}
+
+// 95% Wilson score interval for `wins` out of `n`.
+std::pair<double, double> wilsonInterval(long long wins, long long n) {
+    if (n == 0) return {0.0, 1.0};
+    constexpr double z = 1.959963984540054;
+    const double p = static_cast<double>(wins) / n;
+    const double scale = 1 + z * z / n;
+    const double centre = (p + z * z / (2.0 * n)) / scale;
+    const double half = z * std::sqrt(p * (1 - p) / n + z * z / (4.0 * n * n)) / scale;
+    return {std::max(0.0, centre - half), std::min(1.0, centre + half)};
+}
+
+}  // namespace
+
+OddsReport estimateOdds(const Game& game, const Player* toMove, const OddsConfig& config) {
+    const Clock::time_point start = Clock::now();
+    const Clock::time_point deadline =
+        config.seconds > 0 ? start + std::chrono::duration_cast<Clock::duration>(
+                                         std::chrono::duration<double>(config.seconds))
+                           : Clock::time_point::max();
+
+    const int seats = game.playerCount();
+    int first = 0;
+    for (int i = 0; i < seats; ++i) {
+        if (game.getPlayer(i) == toMove) first = i;
+    }
+
+    // The position every rollout forks: proxy auctions, and the built-in
+    // strategies' turn-order slots for the human seats.
+    std::unique_ptr<Game> root = game.fork();
+    root->getController().setAuctionMode(AuctionMode::ProxyEnglish);
+    std::vector<int> humans;
+    for (int i = 0; i < seats; ++i) {
+        if (!root->getController().getStrategy(root->getPlayer(i))) humans.push_back(i);
+    }
+    const unsigned positionSeed = config.seed ^ static_cast<unsigned>(root->getController().stateHash());
+
+    std::atomic<bool> stop{false};
+    std::function<bool()> expired = [&] {
+        if (stop.load(std::memory_order_relaxed)) return true;
+        if ((config.cancel && config.cancel->load(std::memory_order_relaxed)) || Clock::now() >= deadline) {
+            stop.store(true, std::memory_order_relaxed);
+            return true;
+        }
+        return false;
+    };
+
+    std::vector<std::atomic<long long>> wins(seats);
+    std::atomic<long long> finished{0};
+    std::atomic<long long> onNetWorth{0};
+    std::atomic<long long> next{0};
+    auto worker = [&] {
+        while (!expired()) {
+            const long long i = next.fetch_add(1, std::memory_order_relaxed);
+            if (config.maxRollouts > 0 && i >= config.maxRollouts) break;
+
+            std::unique_ptr<Game> table = root->fork();
+            GameController& controller = table->getController();
+            controller.seed(positionSeed + static_cast<unsigned>(i));
+            const auto strategies = builtinStrategies();
+            for (std::size_t h = 0; h < humans.size(); ++h) {
+                controller.setStrategy(table->getPlayer(humans[h]), strategies[(i + h) % strategies.size()]);
+            }
+
+            bool decidedOnNetWorth = false;
+            const int winner = playRollout(*table, first, config, expired, decidedOnNetWorth);
+            wins[winner].fetch_add(1, std::memory_order_relaxed);
+            onNetWorth.fetch_add(decidedOnNetWorth, std::memory_order_relaxed);
+            finished.fetch_add(1, std::memory_order_relaxed);
+        }
+    };
+
+    unsigned threads = config.threads ? config.threads : std::thread::hardware_concurrency();
+    threads = std::max(1u, threads);
+    if (config.maxRollouts > 0) threads = static_cast<unsigned>(std::min<long long>(threads, config.maxRollouts));
+
+    // The rollouts' console output goes nowhere while they run.
+    std::ios_base::iostate coutState = std::cout.rdstate();
+    std::cout.setstate(std::ios::failbit);
+    std::vector<std::thread> pool;
+    for (unsigned t = 1; t < threads; ++t) pool.emplace_back(worker);
+    worker();
+    for (auto& t : pool) t.join();
+    std::cout.clear(coutState);
+
+    OddsReport report;
+    report.rollouts = finished.load();
+    report.decidedOnNetWorth = onNetWorth.load();
+    report.seconds = std::chrono::duration<double>(Clock::now() - start).count();
+    for (int i = 0; i < seats; ++i) {
+        const Player* p = game.getPlayer(i);
+        if (p->isBankrupt()) continue;
+        PlayerOdds odds;
+        odds.player = p;
+        odds.wins = wins[i].load();
+        odds.winProbability = report.rollouts ? static_cast<double>(odds.wins) / report.rollouts : 0.0;
+        const auto [low, high] = wilsonInterval(odds.wins, report.rollouts);
+        odds.low = low;
+        odds.high = high;
+        report.players.push_back(odds);
+    }
+    return report;
+}
+
+void printOdds(std::ostream& out, const OddsReport& report) {
+    const auto flags = out.flags();
+    const auto precision = out.precision();
+    out << std::fixed << std::setprecision(1);
+    out << "[ODDS] " << report.rollouts << " games played out in " << 1000 * report.seconds << " ms";
+    if (report.decidedOnNetWorth > 0) out << " (" << report.decidedOnNetWorth << " decided on net worth)";
+    out << "\n";
+    out << std::left << std::setw(16) << "Player" << std::right << std::setw(8) << "Win %" << std::setw(18)
+        << "95% interval" << std::setw(8) << "Wins" << "\n";
+    for (const PlayerOdds& odds : report.players) {
+        std::ostringstream interval;
+        interval << std::fixed << std::setprecision(1) << 100 * odds.low << " - " << 100 * odds.high;
+        out << std::left << std::setw(16) << odds.player->getName() << std::right << std::setw(8)
+            << 100 * odds.winProbability << std::setw(18) << interval.str() << std::setw(8) << odds.wins << "\n";
+    }
+    out.flags(flags);
+    out.precision(precision);
+}
@@ -0,0 +1,70 @@
+// Win-Odds.cc (interface)
+// Module: WinOdds
+// Description:
+//   Estimates each player's chance of winning a game in progress by playing
+//   it out many times (the "odds" command): every rollout is a fork of the
+//   game with its own dice seed, played to the end by computer players.
+//
+//   Bots keep their own Strategy. A human seat is played by the built-in
+//   strategies in turn, one per rollout, so the estimate is not tied to a
+//   single style of play. Auctions are proxy English auctions and nothing
+//   is ever asked on std::cin. A rollout that is still going after
+//   maxRounds rounds is won by the player with the highest net worth, so
+//   every rollout has exactly one winner and a player's wins are a
+//   binomial count; the interval reported is the 95% Wilson score
+//   interval, which stays inside [0, 1] and is sensible for rare winners.
+//
+//   Rollouts run on a pool of worker threads until the wall-clock budget
+//   runs out, maxRollouts have been played, or the caller sets `cancel`.
+//   Workers look at the clock and the flags before every round, so the
+//   call returns within about one round's play of the deadline (well under
+//   a millisecond) even when the host is busy. A rollout that is cut off
+//   is scored on net worth like one that reached maxRounds, since
+//   dropping it would leave only the games that ended quickly and favour
+//   whoever wins those. Each finished rollout adds its winner
+//   to shared atomic counters straight away, so nothing is left to merge
+//   when the pool stops. With no time budget the result depends only on
+//   the position, the seed and maxRollouts, not on the number of threads.
+//
+// Related Modules:
+//   - Game (fork), GameController (playBotTurn, stateHash)
+//   - Strategy (the players in the rollouts)
+//   - Tuner (plays seeded bot games the same way)
+
+export module WinOdds;
+
+import <atomic>;
+import <ostream>;
+import <vector>;
+import Game;
+import Player;
+
+export struct OddsConfig {
+    double seconds = 0.2;                  // wall-clock budget; 0 = none (then set maxRollouts or cancel)
+    long long maxRollouts = 0;             // 0 = as many as the budget allows
+    int maxRounds = 200;                   // then the net worth leader wins
+    unsigned threads = 0;                  // 0 = hardware concurrency
+    unsigned seed = 1;                     // mixed with the position's stateHash
+    const std::atomic<bool>* cancel = nullptr;  // stops the pool when set
+};
+
+export struct PlayerOdds {
+    const Player* player = nullptr;  // in the game passed to estimateOdds
+    long long wins = 0;
+    double winProbability = 0;
+    double low = 0;                  // 95% interval
+    double high = 1;
+};
+
+export struct OddsReport {
+    std::vector<PlayerOdds> players;  // players still in, turn order
+    long long rollouts = 0;           // finished rollouts
+    long long decidedOnNetWorth = 0;  // of those, reached maxRounds or were cut off
+    double seconds = 0;               // wall time spent
+};
+
+// Plays out game from the start of toMove's turn. Changes nothing in game.
+export OddsReport estimateOdds(const Game& game, const Player* toMove, const OddsConfig& config = {});
+
+// One line per player: win %, interval and wins (the "odds" command).
+export void printOdds(std::ostream& out, const OddsReport& report);
@@ -0,0 +1,145 @@
+// bench-board.cc
+// Purpose:
+//   Microbenchmarks for Board construction/destruction and square
+//   iteration: the arena-backed Board against the layout it replaced (each
+//   square allocated separately with new, held in a std::vector<Square*>),
+//   and Game::fork() of a four-player game in progress.
+//   Heap allocations per board and per fork are counted by replacing
+//   global operator new.
+//
+// Output: one line per benchmark
+//   BENCH <name> <iterations> <ns/op>
+// followed by allocations per board for each layout and per fork.
+import <chrono>;
+import <cstdlib>;
+import <iostream>;
+import <new>;
+import <string>;
+import <vector>;
+import Board;
+import BoardDefinition;
+import Square;
+import Building;
+import AcademicBuilding;
+import Residence;
+import Gym;
+import ActionSquares;
+import BoardState;
+import Game;
+import Player;
+
+static long long sink = 0;
+static long long allocations = 0;
+
+void* operator new(std::size_t size) {
+    ++allocations;
+    if (void* p = std::malloc(size ? size : 1)) return p;
+    throw std::bad_alloc{};
+}
+// std::pmr's default resource allocates through the aligned forms.
+void* operator new(std::size_t size, std::align_val_t align) {
+    ++allocations;
+    std::size_t alignment = static_cast<std::size_t>(align);
+    if (void* p = std::aligned_alloc(alignment, (size + alignment - 1) / alignment * alignment)) return p;
+    throw std::bad_alloc{};
+}
+// noinline keeps GCC from flagging the inlined free() as a new/free mismatch.
+[[gnu::noinline]] void operator delete(void* p) noexcept { std::free(p); }
+[[gnu::noinline]] void operator delete(void* p, std::size_t) noexcept { std::free(p); }
+[[gnu::noinline]] void operator delete(void* p, std::align_val_t) noexcept { std::free(p); }
+[[gnu::noinline]] void operator delete(void* p, std::size_t, std::align_val_t) noexcept { std::free(p); }
+
+template <typename F>
+static void bench(const std::string& name, long long iterations, F&& body) {
+    auto start = std::chrono::steady_clock::now();
+    for (long long i = 0; i < iterations; ++i) body(i);
+    auto end = std::chrono::steady_clock::now();
+    double ns = std::chrono::duration<double, std::nano>(end - start).count();
+    std::cout << "BENCH " << name << " " << iterations << " " << ns / iterations << "\n";
+}
+
+// The pre-arena layout: one new per square.
+static std::vector<Square*> scatteredBoard(const BoardDefinition& def) {
+    std::vector<Square*> squares;
+    for (int pos = 0; pos < BoardDefinition::Squares; ++pos) {
+        switch (def.squares[pos].kind) {
+            case SquareKind::CollectOSAP:  squares.push_back(new COLLECTOSAP(def, pos)); break;
+            case SquareKind::Academic:     squares.push_back(new AcademicBuilding(def, pos)); break;
+            case SquareKind::Residence:    squares.push_back(new Residence(def, pos)); break;
+            case SquareKind::Gym:          squares.push_back(new Gym(def, pos)); break;
+            case SquareKind::SLC:          squares.push_back(new SLC(def, pos)); break;
+            case SquareKind::Tuition:      squares.push_back(new TUITION(def, pos)); break;
+            case SquareKind::NeedlesHall:  squares.push_back(new NEEDLESHALL(def, pos)); break;
+            case SquareKind::DCTimsLine:   squares.push_back(new DCTimsLine(def, pos)); break;
+            case SquareKind::GooseNesting: squares.push_back(new GooseNesting(def, pos)); break;
+            case SquareKind::GoToTims:     squares.push_back(new GoToTims(def, pos)); break;
+            case SquareKind::CoopFee:      squares.push_back(new CoopFee(def, pos)); break;
+        }
+    }
+    return squares;
+}
+
+int main() {
+    const BoardDefinition& def = standardBoardDefinition();
+    const long long N = 20000;
+
+    bench("board_construct_destroy", N, [&](long long) {
+        Board board;
+        sink += board.getSquare(39)->getPosition();
+    });
+    bench("scattered_construct_destroy_reference", N, [&](long long) {
+        std::vector<Square*> squares = scatteredBoard(def);
+        sink += squares[39]->getPosition();
+        for (auto* s : squares) delete s;
+    });
+
+    // Iteration: total price of every building, via the virtual interface.
+    Board board;
+    std::vector<Square*> scattered = scatteredBoard(def);
+    bench("board_sum_prices", N * 10, [&](long long) {
+        for (int i = 0; i < BoardDefinition::Squares; ++i) {
+            if (auto* b = dynamic_cast<Building*>(board.getSquare(i))) sink += b->getPrice();
+        }
+    });
+    bench("scattered_sum_prices_reference", N * 10, [&](long long) {
+        for (auto* s : scattered) {
+            if (auto* b = dynamic_cast<Building*>(s)) sink += b->getPrice();
+        }
+    });
+    for (auto* s : scattered) delete s;
+
+    // Fork: four players, half the board owned, one improvement.
+    Game game;
+    const char* tokens[] = {"G", "B", "D", "P"};
+    for (int i = 0; i < 4; ++i) game.addPlayer("Player" + std::to_string(i), tokens[i]);
+    for (int pos = 0; pos < BoardDefinition::Squares; pos += 2) {
+        if (auto* b = dynamic_cast<Building*>(game.getBoard().getSquare(pos))) {
+            b->setOwner(game.getPlayer(pos % 4));
+        }
+    }
+    bench("game_fork", N, [&](long long) {
+        auto copy = game.fork();
+        sink += copy->getPlayer(3)->getMoney();
+    });
+
+    long long before = allocations;
+    { auto copy = game.fork(); }
+    long long forkAllocations = allocations - before;
+
+    before = allocations;
+    { Board counted; }
+    long long boardAllocations = allocations - before;
+    before = allocations;
+    {
+        std::vector<Square*> counted = scatteredBoard(def);
+        for (auto* s : counted) delete s;
+    }
+    long long scatteredAllocations = allocations - before;
+
+    std::cout << "allocations per board: " << boardAllocations
+              << " (scattered reference: " << scatteredAllocations << ")\n";
+    std::cout << "allocations per fork (4 players): " << forkAllocations << "\n";
+    std::cout << "per-game mutable state: " << sizeof(BoardState) << " bytes\n";
+    std::cout << "checksum " << sink << "\n";
+    return 0;
+}
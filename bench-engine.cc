@@ -0,0 +1,300 @@
+// bench-engine.cc
+// Purpose:
+//   Regression microbenchmarks for the engine's hot paths, run by
+//   `make bench` alongside the other bench-*.cc programs:
+//     - AcademicBuilding::calculateRent across improvement levels
+//     - GameController::hasMonopoly (by block index and by name),
+//       getResidenceCount and getGymCount
+//     - a full headless GameController::playTurn (four bots, proxy auctions)
+//     - Board::getSquareByName
+//     - new_Display::printGameBoard
+//     - save and load of a game in progress, separately and round trip
+//     - each built-in Strategy's buy and maxBid decisions
+//     - a headless playBotTurn (four bots, one per built-in strategy)
+//     - one whole tuning game (Tuner's playTuningGame, 200 rounds at most)
+//     - BatchEngine::playTurn, one turn of 1024 lockstep games
+//     - RiskMap's exact assessTurn, from each seat of the mid-game position
+//     - a one-turn EndgameSolver search on one thread (two players, a
+//       monopoly to build on)
+//     - WinOdds: ten rollouts of the mid-game position on one thread
+//   Every benchmark uses fixed positions and a fixed RNG seed, so two runs
+//   do the same work. Console output produced inside the timed loops is
+//   formatted as usual and then discarded. Heap allocations are counted by
+//   replacing global operator new.
+//
+// Output: one line per benchmark
+//   BENCH <name> <iterations> <ns/op> <allocs/op>
+// followed by a checksum.
+import <chrono>;
+import <cstdlib>;
+import <iostream>;
+import <new>;
+import <set>;
+import <sstream>;
+import <string>;
+import <vector>;
+import Game;
+import GameController;
+import Board;
+import BoardDefinition;
+import Player;
+import Building;
+import AcademicBuilding;
+import new_Display;
+import SaveFile;
+import Strategy;
+import Tuner;
+import BatchEngine;
+import RiskMap;
+import EndgameSolver;
+import WinOdds;
+
+static long long sink = 0;
+static long long allocations = 0;
+
+void* operator new(std::size_t size) {
+    ++allocations;
+    if (void* p = std::malloc(size ? size : 1)) return p;
+    throw std::bad_alloc{};
+}
+// std::pmr's default resource allocates through the aligned forms.
+void* operator new(std::size_t size, std::align_val_t align) {
+    ++allocations;
+    std::size_t alignment = static_cast<std::size_t>(align);
+    if (void* p = std::aligned_alloc(alignment, (size + alignment - 1) / alignment * alignment)) return p;
+    throw std::bad_alloc{};
+}
+// noinline keeps GCC from flagging the inlined free() as a new/free mismatch.
+[[gnu::noinline]] void operator delete(void* p) noexcept { std::free(p); }
+[[gnu::noinline]] void operator delete(void* p, std::size_t) noexcept { std::free(p); }
+[[gnu::noinline]] void operator delete(void* p, std::align_val_t) noexcept { std::free(p); }
+[[gnu::noinline]] void operator delete(void* p, std::size_t, std::align_val_t) noexcept { std::free(p); }
+
+// Accepts and drops everything written to it.
+class DiscardBuffer : public std::streambuf {
+protected:
+    int overflow(int c) override { return c; }
+    std::streamsize xsputn(const char*, std::streamsize n) override { return n; }
+};
+
+template <typename F>
+static void bench(const std::string& name, long long iterations, F&& body) {
+    DiscardBuffer discard;
+    std::streambuf* saved = std::cout.rdbuf(&discard);
+    long long before = allocations;
+    auto start = std::chrono::steady_clock::now();
+    for (long long i = 0; i < iterations; ++i) body(i);
+    auto end = std::chrono::steady_clock::now();
+    long long allocated = allocations - before;
+    std::cout.rdbuf(saved);
+    double ns = std::chrono::duration<double, std::nano>(end - start).count();
+    std::cout << "BENCH " << name << " " << iterations << " " << ns / iterations
+              << " " << static_cast<double>(allocated) / iterations << "\n";
+}
+
+static const char* const names[] = {"Vyomm", "Bhavish", "Chris", "Dana"};
+static const char* const tokens[] = {"G", "B", "D", "P"};
+constexpr int BotMoney = 1000000;  // bots never reach the liquidation prompts
+
+// A mid-game position: each academic block, residence and gym goes to one
+// player in rotation, monopolies carry improvements, and one property is
+// mortgaged.
+static void seatAndDeal(Game& game) {
+    for (int i = 0; i < 4; ++i) game.addPlayer(names[i], tokens[i]);
+    const BoardDefinition& def = game.getBoard().getDefinition();
+    std::vector<std::string> blocks;
+    for (int pos = 0; pos < BoardDefinition::Squares; ++pos) {
+        auto* b = dynamic_cast<Building*>(game.getBoard().getSquare(pos));
+        if (!b) continue;
+        int owner = pos % 4;
+        if (def.squares[pos].kind == SquareKind::Academic) {
+            const std::string& block = def.squares[pos].block;
+            if (blocks.empty() || blocks.back() != block) blocks.push_back(block);
+            owner = static_cast<int>(blocks.size()) % 4;
+        }
+        b->setOwner(game.getPlayer(owner));
+    }
+    for (int pos = 0; pos < BoardDefinition::Squares; ++pos) {
+        if (auto* ab = dynamic_cast<AcademicBuilding*>(game.getBoard().getSquare(pos))) {
+            if (game.getController().hasMonopoly(ab->getOwner(), ab->getBlockId())) {
+                ab->forceSetImprovements(pos % 6);
+            }
+        }
+    }
+    Building* pac = game.getController().getBuilding("PAC");
+    game.getController().mortgageBuilding(pac->getOwner(), pac);
+}
+
+int main() {
+    // Purchases are declined (no input) and go to proxy auction.
+    std::istringstream noInput;
+    auto* savedCin = std::cin.rdbuf(noInput.rdbuf());
+    const long long N = 1000000;
+
+    Game game;
+    std::cout.setstate(std::ios::failbit);
+    seatAndDeal(game);
+    std::cout.clear();
+    Board& board = game.getBoard();
+    GameController& controller = game.getController();
+    const BoardDefinition& def = board.getDefinition();
+
+    // === Rent and ownership queries ===
+    std::vector<AcademicBuilding*> academics;
+    std::vector<std::string> squareNames;
+    std::set<std::string> blockNames;
+    for (int pos = 0; pos < BoardDefinition::Squares; ++pos) {
+        if (auto* ab = dynamic_cast<AcademicBuilding*>(board.getSquare(pos))) academics.push_back(ab);
+        squareNames.push_back(def.squares[pos].name);
+        if (!def.squares[pos].block.empty()) blockNames.insert(def.squares[pos].block);
+    }
+    const std::vector<std::string> blocks(blockNames.begin(), blockNames.end());
+    const std::vector<std::string> tokenNames(std::begin(tokens), std::end(tokens));
+
+    bench("academic_calculateRent", N, [&](long long i) {
+        sink += academics[i % academics.size()]->calculateRent(static_cast<int>(i & 1));
+    });
+    bench("controller_hasMonopoly", N, [&](long long i) {
+        const AcademicBuilding* ab = academics[i % academics.size()];
+        sink += controller.hasMonopoly(game.getPlayer(i % 4), ab->getBlockId());
+    });
+    bench("controller_hasMonopoly_by_name", N, [&](long long i) {
+        sink += controller.hasMonopoly(tokenNames[i % 4], blocks[i % blocks.size()]);
+    });
+    bench("controller_getResidenceCount", N, [&](long long i) {
+        sink += controller.getResidenceCount(tokenNames[i % 4]);
+    });
+    bench("controller_getGymCount", N, [&](long long i) {
+        sink += controller.getGymCount(tokenNames[i % 4]);
+    });
+    bench("board_getSquareByName", N, [&](long long i) {
+        sink += board.getSquareByName(squareNames[i % squareNames.size()]) != nullptr;
+    });
+
+    // === Display ===
+    new_Display disp;
+    std::vector<Player*> players = game.getPlayers();
+    bench("display_printGameBoard", N / 1000, [&](long long) {
+        disp.printGameBoard(board, players);
+    });
+
+    // === Save / load ===
+    std::ostringstream saved;
+    writeSaveFile(saved, players, board, controller);
+    const std::string saveText = saved.str();
+    bench("save_game", N / 100, [&](long long) {
+        std::ostringstream out;
+        writeSaveFile(out, players, board, controller);
+        sink += out.tellp();
+    });
+    bench("load_game", N / 100, [&](long long) {
+        std::istringstream in{saveText};
+        Game loaded;
+        sink += readSaveFile(in, loaded).size();
+    });
+    bench("save_load_roundtrip", N / 100, [&](long long) {
+        std::stringstream file;
+        writeSaveFile(file, players, board, controller);
+        Game loaded;
+        sink += readSaveFile(file, loaded)[1]->getMoney();
+    });
+
+    // === Strategy decisions (every building, from each seat's view) ===
+    std::vector<Building*> buildingsOnBoard;
+    for (int pos = 0; pos < BoardDefinition::Squares; ++pos) {
+        if (auto* b = dynamic_cast<Building*>(board.getSquare(pos))) buildingsOnBoard.push_back(b);
+    }
+    for (const Strategy* s : builtinStrategies()) {
+        std::string name{s->name()};
+        bench("strategy_buy_" + name, N, [&](long long i) {
+            sink += s->buy(*game.getPlayer(i % 4), *buildingsOnBoard[i % buildingsOnBoard.size()], board);
+        });
+        bench("strategy_maxBid_" + name, N, [&](long long i) {
+            sink += s->maxBid(*game.getPlayer(i % 4), *buildingsOnBoard[i % buildingsOnBoard.size()], board);
+        });
+    }
+
+    // === Headless turns ===
+    // Four bots with a fixed seed bidding the list price in proxy auctions;
+    // their money is topped up so every turn takes the same code paths
+    // however long the run.
+    Game bots;
+    for (int i = 0; i < 4; ++i) bots.addPlayer(names[i], tokens[i], BotMoney);
+    GameController& botController = bots.getController();
+    botController.seed(1);
+    botController.setAuctionMode(AuctionMode::ProxyEnglish);
+    botController.setProxyBidSource([](const Player*, const Building* b) { return b->getPrice(); });
+    bench("controller_playTurn", N / 10, [&](long long i) {
+        Player* p = bots.getPlayer(i % 4);
+        if (p->getMoney() < BotMoney / 2) p->setMoney(BotMoney);
+        botController.playTurn(p);
+        sink += p->getPosition();
+    });
+
+    // The same table played by the built-in strategies, with no proxy
+    // source: every decision comes from a Strategy.
+    Game strategyBots;
+    for (int i = 0; i < 4; ++i) {
+        Player* p = strategyBots.addPlayer(names[i], tokens[i], BotMoney);
+        strategyBots.getController().setStrategy(p, builtinStrategies()[i]);
+    }
+    GameController& strategyController = strategyBots.getController();
+    strategyController.seed(1);
+    strategyController.setAuctionMode(AuctionMode::ProxyEnglish);
+    bench("controller_playBotTurn", N / 10, [&](long long i) {
+        Player* p = strategyBots.getPlayer(i % 4);
+        if (p->getMoney() < BotMoney / 2) p->setMoney(BotMoney);
+        strategyController.playBotTurn(p);
+        sink += p->getPosition();
+    });
+
+    TunerConfig tuning;
+    ParametricStrategy candidate;
+    bench("tuner_playTuningGame", N / 1000, [&](long long i) {
+        sink += static_cast<long long>(1000 * playTuningGame(candidate, tuning, static_cast<int>(i), 1 + i));
+    });
+
+    // The always-buy table of the scalar benches, 1024 games at a time;
+    // with BotMoney no lane stops within the run. Divide by 1024 to
+    // compare with controller_playTurn.
+    BatchEngine batch{1024, 4, 1, standardBoardDefinition(), BotMoney};
+    batch.setTokens(tokenNames);
+    bench("batch_playTurn_1024", N / 1000, [&](long long i) {
+        batch.playTurn();
+        sink += batch.position(static_cast<int>(i % 1024), static_cast<int>(i % 4));
+    });
+    sink += batch.playing();
+
+    bench("risk_assessTurn", N / 1000, [&](long long i) {
+        RiskReport report = assessTurn(controller, board, game.getPlayer(i % 4));
+        sink += static_cast<long long>(report.expectedCashChange);
+    });
+
+    Game duel;
+    Player* builder = duel.addPlayer(names[0], tokens[0], 600);
+    Player* rival = duel.addPlayer(names[1], tokens[1], 600);
+    for (const char* name : {"EV1", "EV2", "EV3"}) duel.getController().getBuilding(name)->setOwner(builder);
+    for (const char* name : {"MKV", "PAC"}) duel.getController().getBuilding(name)->setOwner(rival);
+    duel.getController().recalculateAssets();
+    EndgameConfig endgame;
+    endgame.depth = 1;
+    endgame.seconds = 0;
+    endgame.threads = 1;
+    bench("endgame_solve_depth1", N / 1000, [&](long long i) {
+        EndgameResult result = solveEndgame(duel, i % 2 ? rival : builder, endgame);
+        sink += result.nodes + static_cast<long long>(1000 * result.winProbability);
+    });
+
+    OddsConfig odds;
+    odds.seconds = 0;
+    odds.maxRollouts = 10;
+    odds.threads = 1;
+    bench("odds_10_rollouts", N / 1000, [&](long long i) {
+        odds.seed = static_cast<unsigned>(i);
+        sink += estimateOdds(game, game.getPlayer(i % 4), odds).players[0].wins;
+    });
+
+    std::cin.rdbuf(savedCin);
+    std::cout << "checksum " << sink << "\n";
+    return 0;
+}
@@ -0,0 +1,153 @@
+// bench-game.cc
+// Purpose:
+//   Allocator traffic of short simulated games: a Game (one monotonic arena
+//   per game) against the hand-wired setup it replaced (Board, controller
+//   and `new Player`s on the heap, freed one by one, as main.cc used to do).
+//   Each game seats four players, plays ten rounds of random turns with
+//   proxy auctions settled by a fixed bidding rule, and is torn down.
+//   Heap allocations are counted by replacing global operator new.
+//
+// Output: one line per benchmark
+//   BENCH <name> <iterations> <ns/op>
+// followed by heap allocations per game for each setup.
+import <chrono>;
+import <cstdlib>;
+import <iostream>;
+import <new>;
+import <sstream>;
+import <string>;
+import <vector>;
+import Game;
+import GameController;
+import Board;
+import Player;
+import Building;
+
+static long long sink = 0;
+static long long allocations = 0;
+
+void* operator new(std::size_t size) {
+    ++allocations;
+    if (void* p = std::malloc(size ? size : 1)) return p;
+    throw std::bad_alloc{};
+}
+// std::pmr's default resource allocates through the aligned forms.
+void* operator new(std::size_t size, std::align_val_t align) {
+    ++allocations;
+    std::size_t alignment = static_cast<std::size_t>(align);
+    if (void* p = std::aligned_alloc(alignment, (size + alignment - 1) / alignment * alignment)) return p;
+    throw std::bad_alloc{};
+}
+// noinline keeps GCC from flagging the inlined free() as a new/free mismatch.
+[[gnu::noinline]] void operator delete(void* p) noexcept { std::free(p); }
+[[gnu::noinline]] void operator delete(void* p, std::size_t) noexcept { std::free(p); }
+[[gnu::noinline]] void operator delete(void* p, std::align_val_t) noexcept { std::free(p); }
+[[gnu::noinline]] void operator delete(void* p, std::size_t, std::align_val_t) noexcept { std::free(p); }
+
+template <typename F>
+static void bench(const std::string& name, long long iterations, F&& body) {
+    auto start = std::chrono::steady_clock::now();
+    for (long long i = 0; i < iterations; ++i) body(i);
+    auto end = std::chrono::steady_clock::now();
+    double ns = std::chrono::duration<double, std::nano>(end - start).count();
+    std::cout << "BENCH " << name << " " << iterations << " " << ns / iterations << "\n";
+}
+
+static const char* const names[] = {"Vyomm", "Bhavish", "Chris", "Dana"};
+static const char* const tokens[] = {"G", "B", "D", "P"};
+constexpr int Rounds = 10;
+constexpr int StartMoney = 20000;  // nobody goes bankrupt within Rounds
+
+// Bots: proxy auctions, bidding the list price while they can afford it.
+static void configure(GameController& controller, unsigned seed) {
+    controller.seed(seed);
+    controller.setAuctionMode(AuctionMode::ProxyEnglish);
+    controller.setProxyBidSource([](const Player* p, const Building* b) {
+        return p->getMoney() > 2 * b->getPrice() ? b->getPrice() : 0;
+    });
+}
+
+// Before Game: everything allocated and freed on its own.
+static void heapGame(unsigned seed) {
+    Board board;
+    GameController controller;
+    controller.setBoard(&board);
+    std::vector<Player*> players;
+    for (int i = 0; i < 4; ++i) {
+        Player* p = new Player(names[i], tokens[i], StartMoney);
+        controller.addPlayer(p);
+        players.push_back(p);
+    }
+    configure(controller, seed);
+    for (int r = 0; r < Rounds; ++r) {
+        for (auto* p : players) controller.playTurn(p);
+    }
+    sink += players[0]->getMoney();
+    for (auto* p : players) delete p;
+}
+
+static void arenaGame(unsigned seed) {
+    Game game;
+    for (int i = 0; i < 4; ++i) game.addPlayer(names[i], tokens[i], StartMoney);
+    GameController& controller = game.getController();
+    configure(controller, seed);
+    for (int r = 0; r < Rounds; ++r) {
+        for (int i = 0; i < game.playerCount(); ++i) controller.playTurn(game.getPlayer(i));
+    }
+    sink += game.getPlayer(0)->getMoney();
+}
+
+int main() {
+    // Purchases are declined (no input) and go to proxy auction; the game's
+    // own console output is muted while timing.
+    std::istringstream noInput;
+    auto* savedCin = std::cin.rdbuf(noInput.rdbuf());
+    const long long N = 2000;
+
+    std::cout.setstate(std::ios::failbit);
+    long long before = allocations;
+    heapGame(1);
+    long long heapAllocations = allocations - before;
+    before = allocations;
+    arenaGame(1);
+    long long arenaAllocations = allocations - before;
+    std::cout.clear();
+
+    std::cout.setstate(std::ios::failbit);
+    auto start = std::chrono::steady_clock::now();
+    for (long long i = 0; i < N; ++i) heapGame(static_cast<unsigned>(i));
+    double heapNs = std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - start).count();
+    start = std::chrono::steady_clock::now();
+    for (long long i = 0; i < N; ++i) arenaGame(static_cast<unsigned>(i));
+    double arenaNs = std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - start).count();
+    std::cout.clear();
+
+    std::cout << "BENCH heap_game_reference " << N << " " << heapNs / N << "\n";
+    std::cout << "BENCH arena_game " << N << " " << arenaNs / N << "\n";
+
+    // Setup and teardown alone, where the allocator is most of the work.
+    bench("heap_setup_teardown_reference", N * 10, [](long long) {
+        Board board;
+        GameController controller;
+        controller.setBoard(&board);
+        std::vector<Player*> players;
+        for (int i = 0; i < 4; ++i) {
+            Player* p = new Player(names[i], tokens[i], StartMoney);
+            controller.addPlayer(p);
+            players.push_back(p);
+        }
+        sink += players.size();
+        for (auto* p : players) delete p;
+    });
+    bench("arena_setup_teardown", N * 10, [](long long) {
+        Game game;
+        for (int i = 0; i < 4; ++i) game.addPlayer(names[i], tokens[i], StartMoney);
+        sink += game.playerCount();
+    });
+
+    std::cin.rdbuf(savedCin);
+    std::cout << "heap allocations per game: " << arenaAllocations
+              << " (heap-wired reference: " << heapAllocations << ")\n";
+    std::cout << "checksum " << sink << "\n";
+    return 0;
+}
@@ -0,0 +1,76 @@
+// bench-lookup.cc
+// Purpose:
+//   Microbenchmarks for square/building name resolution: the compile-time
+//   perfect hash (Board::indexOf, getSquareByName, GameController::
+//   getBuilding) against the approaches it replaced — a linear scan with
+//   string compares and a std::map<std::string, Building*> lookup.
+//   Queries rotate over every building name plus one unknown name.
+//
+// Output: one line per benchmark
+//   BENCH <name> <iterations> <ns/op>
+import <chrono>;
+import <iostream>;
+import <map>;
+import <string>;
+import <vector>;
+import GameController;
+import Board;
+import Building;
+import Square;
+import SquareNames;
+
+static long long sink = 0;
+
+template <typename F>
+static void bench(const std::string& name, long long iterations, F&& body) {
+    auto start = std::chrono::steady_clock::now();
+    for (long long i = 0; i < iterations; ++i) body(i);
+    auto end = std::chrono::steady_clock::now();
+    double ns = std::chrono::duration<double, std::nano>(end - start).count();
+    std::cout << "BENCH " << name << " " << iterations << " " << ns / iterations << "\n";
+}
+
+int main() {
+    Board board;
+    GameController controller;
+    controller.setBoard(&board);
+
+    // Names as the command loop sees them: std::strings read from input.
+    std::vector<std::string> names;
+    std::map<std::string, Building*> reference;
+    for (int i = 0; i < 40; ++i) {
+        if (auto* b = dynamic_cast<Building*>(board.getSquare(i))) {
+            names.push_back(b->getName());
+            reference[b->getName()] = b;
+        }
+    }
+    names.push_back("NOT_A_SQUARE");
+    const std::size_t count = names.size();
+    const long long N = 1000000;
+
+    bench("scan_reference", N, [&](long long i) {
+        const std::string& name = names[i % count];
+        for (int s = 0; s < 40; ++s) {
+            if (board.getSquare(s)->getName() == name) { sink += s; break; }
+        }
+    });
+    bench("std_map_reference", N, [&](long long i) {
+        auto it = reference.find(names[i % count]);
+        sink += it != reference.end();
+    });
+    bench("perfect_hash_raw", N, [&](long long i) {
+        sink += canonicalSquareIndex(names[i % count]);
+    });
+    bench("board_indexOf", N, [&](long long i) {
+        sink += board.indexOf(names[i % count]);
+    });
+    bench("board_getSquareByName", N, [&](long long i) {
+        sink += board.getSquareByName(names[i % count]) != nullptr;
+    });
+    bench("controller_getBuilding", N, [&](long long i) {
+        sink += controller.getBuilding(names[i % count]) != nullptr;
+    });
+
+    std::cout << "checksum " << sink << "\n";
+    return 0;
+}
@@ -0,0 +1,120 @@
+// bench-validation.cc
+// Purpose:
+//   Microbenchmarks for the block-rule validation paths: monopoly checks,
+//   "any improvements in this block" checks, and the full trade and
+//   mortgage validations that use them. The old approach (scanning every
+//   building and comparing block-name strings) is reproduced here as a
+//   reference so the two can be compared directly.
+//
+// Output: one line per benchmark
+//   BENCH <name> <iterations> <ns/op>
+import <chrono>;
+import <iostream>;
+import <string>;
+import GameController;
+import Board;
+import Player;
+import Building;
+import AcademicBuilding;
+import BlockIndex;
+
+// Accumulates results (printed at the end) so the optimiser can't drop the work.
+static long long sink = 0;
+
+template <typename F>
+static void bench(const std::string& name, long long iterations, F&& body) {
+    auto start = std::chrono::steady_clock::now();
+    for (long long i = 0; i < iterations; ++i) body(i);
+    auto end = std::chrono::steady_clock::now();
+    double ns = std::chrono::duration<double, std::nano>(end - start).count();
+
+    // Game messages may be muted around the body; results always print.
+    auto state = std::cout.rdstate();
+    std::cout.clear();
+    std::cout << "BENCH " << name << " " << iterations << " " << ns / iterations << "\n";
+    std::cout.setstate(state);
+}
+
+// The pre-index monopoly check: every square, dynamic_cast, string compares.
+static bool scanHasMonopoly(const Board& board, const std::string& token, const std::string& block) {
+    for (int i = 0; i < 40; ++i) {
+        auto* ab = dynamic_cast<AcademicBuilding*>(board.getSquare(i));
+        if (ab && ab->getMonopolyBlock() == block && ab->getOwnerToken() != token) return false;
+    }
+    return true;
+}
+
+static bool scanBlockImproved(const Board& board, const std::string& block) {
+    for (int i = 0; i < 40; ++i) {
+        auto* ab = dynamic_cast<AcademicBuilding*>(board.getSquare(i));
+        if (ab && ab->getMonopolyBlock() == block && ab->getImprovementCount() > 0) return true;
+    }
+    return false;
+}
+
+int main() {
+    Board board;
+    GameController controller;
+    controller.setBoard(&board);
+
+    Player* vyomm = new Player("Vyomm", "V");
+    Player* bhavish = new Player("Bhavish", "B");
+    controller.addPlayer(vyomm);
+    controller.addPlayer(bhavish);
+    vyomm->setMoney(1000000);
+
+    // Vyomm: all of Math (DC improved) and EV1; Bhavish: AL.
+    auto* mc = dynamic_cast<AcademicBuilding*>(board.getSquareByName("MC"));
+    auto* dc = dynamic_cast<AcademicBuilding*>(board.getSquareByName("DC"));
+    auto* ev1 = dynamic_cast<AcademicBuilding*>(board.getSquareByName("EV1"));
+    mc->setOwner(vyomm);
+    dc->setOwner(vyomm);
+    ev1->setOwner(vyomm);
+    dynamic_cast<Building*>(board.getSquareByName("AL"))->setOwner(bhavish);
+
+    std::cout.setstate(std::ios::failbit);
+    controller.improveBuilding(vyomm, dc);
+    std::cout.clear();
+
+    const long long N = 200000;
+
+    // Queries rotate over every block so nothing is loop-invariant.
+    const BlockIndex& blocks = board.getBlocks();
+    const int blockCount = blocks.size();
+
+    bench("monopoly_scan_reference", N, [&](long long i) {
+        sink += scanHasMonopoly(board, "V", blocks.name(i % blockCount));
+    });
+    bench("monopoly_by_name", N, [&](long long i) {
+        sink += controller.hasMonopoly("V", blocks.name(i % blockCount));
+    });
+    bench("monopoly_by_block_id", N, [&](long long i) {
+        sink += controller.hasMonopoly(vyomm, i % blockCount);
+    });
+
+    bench("block_improved_scan_reference", N, [&](long long i) {
+        sink += scanBlockImproved(board, blocks.name(i % blockCount));
+    });
+    bench("block_improved_index", N, [&](long long i) {
+        sink += blocks.improvements(i % blockCount) > 0;
+    });
+
+    // Full validations through the controller (messages muted).
+    std::cout.setstate(std::ios::failbit);
+    bench("trade_rejected_improved_block", N / 10, [&](long long) {
+        controller.trade("V", "MC", "B", "AL");
+    });
+    bench("mortgage_rejected_improved_block", N / 10, [&](long long) {
+        sink += controller.mortgageBuilding(vyomm, mc);
+    });
+    bench("mortgage_unmortgage_round_trip", N / 10, [&](long long) {
+        sink += controller.mortgageBuilding(vyomm, ev1);
+        sink += controller.unmortgageBuilding(vyomm, ev1);
+    });
+    std::cout.clear();
+
+    std::cout << "checksum " << sink << "\n";
+    delete vyomm;
+    delete bhavish;
+    return 0;
+}
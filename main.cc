@@ -7,19 +7,43 @@ import <vector>;
 import <map>;
 import <set>;
 import <ctime>;
+import <stdexcept>;
 import Player;
 import Board;
 import GameController;
+import Game;
 import AcademicBuilding; // Needed for dynamic_cast
 import new_Display;
 import Building;
+import Spectator;
+import BoardDefinition;
+import TurnStats;
+import GameAnalytics;
+import SaveFile;
+import Trace;
+import Strategy;
+import RiskMap;
+import WinOdds;
 
 int main(int argc, char* argv[]) {
-    std::srand(static_cast<unsigned>(time(nullptr)));
+    // Board variant from "-board file" (validated before anything else).
+    BoardDefinition boardDefinition = standardBoardDefinition();
+    for (int i = 1; i + 1 < argc; ++i) {
+        if (std::string(argv[i]) == "-board") {
+            try {
+                boardDefinition = loadBoardDefinition(argv[i + 1]);
+            } catch (const std::runtime_error& e) {
+                std::cerr << "Error loading board: " << e.what() << "\n";
+                return 1;
+            }
+        }
+    }
 
-    Board board;
-    GameController controller;
-    controller.setBoard(&board);
+    // The game owns the board, the players and the controller.
+    Game game{boardDefinition};
+    Board& board = game.getBoard();
+    GameController& controller = game.getController();
+    controller.seed(static_cast<unsigned>(time(nullptr)));
     new_Display disp;
 
     const std::map<char, std::string> validTokens = {
@@ -39,100 +63,61 @@ int main(int argc, char* argv[]) {
 
     bool testingMode = false;
     std::string loadFile;
+    std::string spectatePath;
+    std::string analyticsPath;
+    std::string tracePath;
     for (int i = 1; i < argc; ++i) {
         if (std::string(argv[i]) == "-testing") {
             testingMode = true;
         } else if (std::string(argv[i]) == "-load" && i + 1 < argc) {
             loadFile = argv[i + 1];
+        } else if (std::string(argv[i]) == "-spectate" && i + 1 < argc) {
+            spectatePath = argv[i + 1];
+        } else if (std::string(argv[i]) == "-analytics" && i + 1 < argc) {
+            analyticsPath = argv[i + 1];
+        } else if (std::string(argv[i]) == "-trace" && i + 1 < argc) {
+            tracePath = argv[i + 1];
+        } else if (std::string(argv[i]) == "-auction" && i + 1 < argc) {
+            // Proxy auctions: each bidder gives one maximum, settled in one pass
+            std::string rule = argv[i + 1];
+            if (rule == "english") {
+                controller.setAuctionMode(AuctionMode::ProxyEnglish);
+            } else if (rule == "second") {
+                controller.setAuctionMode(AuctionMode::ProxySecondPrice);
+            } else {
+                std::cerr << "Unknown auction rule: " << rule << " (use english|second)\n";
+                return 1;
+            }
         }
     }
 
+    // Optional live feed for external viewers (Unix socket, or an existing FIFO).
+    SpectatorChannel* spectator = nullptr;
+    if (!spectatePath.empty()) {
+        spectator = new SpectatorChannel(spectatePath);
+        if (!spectator->isOpen()) {
+            std::cerr << "[Warning] Could not open spectator feed at " << spectatePath
+                      << " (an existing file must be a FIFO or socket); the feed is off\n";
+        }
+        controller.setSpectator(spectator);
+    }
+
     if (!loadFile.empty()) {
         std::ifstream in(loadFile);
         if (!in) {
             std::cerr << "Error opening file: " << loadFile << "\n";
+            delete spectator;
             return 1;
         }
 
-        int numPlayers;
-        in >> numPlayers;
-
-        for (int i = 0; i < numPlayers; ++i) {
-            std::string name;
-            char token;
-            int cups, money, pos;
-            in >> name >> token >> cups >> money >> pos;
-
-            Player* p = new Player(name, std::string(1, token));
-            p->setRollUpCups(cups);
-            p->setMoney(money);
-            p->moveTo(pos);
-
-            if (pos == 10) {
-                int inTims;
-                in >> inTims;
-                if (inTims == 1) {
-                    int turns;
-                    in >> turns;
-                    p->setInTims(true);
-                    for (int j = 0; j < turns; ++j) p->incrementTimsTurn();
-                }
-            }
-
-            usedTokens.insert(token);
-            controller.addPlayer(p);
-            players.push_back(p);
-        }
-
-        std::string propertyName, owner;
-        int improvements;
-        while (in >> propertyName >> owner >> improvements) {
-            std::cerr << "[DEBUG] Processing: " << propertyName
-              << " | Owner: " << owner
-              << " | Improvements: " << improvements << std::endl;
-            auto* b = controller.getBuilding(propertyName);
-            if (!b) continue;
-
-            if (owner != "BANK") {
-                for (auto* p : players) {
-                    if (p->getName() == owner) {
-                        p->addProperty(b->getName());
-                        b->setOwnerToken(p->getToken());
-                        break;
-                    }
-                }
-            }
-
-            if (!b) {
-                std::cerr << "[Warning] Could not find building with name: "
-                          << propertyName << " (skipping)\n";
-                continue;
-            }
-            
-            if (improvements == -1) {
-                Player* ownerPlayer = controller.getPlayer(b->getOwnerToken());
-                if (!ownerPlayer) {
-                    std::cerr << "[ERROR] Couldn't find owner for mortgaging: "
-                              << b->getName() << " with token: " << b->getOwnerToken() << "\n";
-                    continue;
-                }
-                std::cerr << "[DEBUG] Mortgaging: " << b->getName() << " for " << ownerPlayer->getName() << "\n";
-                controller.mortgageBuilding(ownerPlayer, b);
-            } else {
-                if (auto* ab = dynamic_cast<AcademicBuilding*>(b)) {
-                    ab->forceSetImprovements(improvements);
-                } else {
-                    if (improvements != 0) {
-                        std::cerr << "[Warning] Non-academic building " << b->getName()
-                                  << " cannot have improvements. Ignoring improvement count: "
-                                  << improvements << "\n";
-                    }
-                    // Do nothing — non-academic buildings can't have improvements
-                }
-            }
-            
-            
+        try {
+            players = readSaveFile(in, game);
+        } catch (const std::runtime_error& e) {
+            std::cerr << "Error loading " << loadFile << ": " << e.what() << "\n";
+            delete spectator;
+            return 1;
         }
+        for (auto* p : players) usedTokens.insert(p->getToken()[0]);
     } else {
         int numPlayers = 0;
         std::cout << "Enter number of players (2–8): ";
@@ -163,14 +148,41 @@ int main(int argc, char* argv[]) {
             }
 
             usedTokens.insert(token);
-            Player* p = new Player(name, std::string(1, token));
-            controller.addPlayer(p);
-            players.push_back(p);
+            players.push_back(game.addPlayer(name, std::string(1, token)));
+
+            // Human, or a computer player with one of the built-in strategies
+            std::cout << "Who plays " << name << "? (human";
+            for (const Strategy* s : builtinStrategies()) std::cout << ", " << s->name();
+            std::cout << "): ";
+            std::string controlledBy;
+            std::cin >> controlledBy;
+            while (controlledBy != "human" && !findStrategy(controlledBy)) {
+                std::cout << "Unknown player type. Choose another: ";
+                std::cin >> controlledBy;
+            }
+            controller.setStrategy(players.back(), findStrategy(controlledBy));
         }
     }
 
 
-    disp.printGameBoard(board, players);
+    // Per-phase turn timings for "stats" and the dump at exit (recorded
+    // only in builds with TURN_STATS=1).
+    TurnStats turnStats;
+    controller.setTurnStats(&turnStats);
+
+    // Per-square counters, written as CSV when the game ends ("-analytics file").
+    AnalyticsBlock analytics;
+    if (!analyticsPath.empty()) controller.setAnalytics(&analytics);
+    // Chrome trace of turns, decisions and rendering, written at exit ("-trace file").
+    if (!tracePath.empty()) Tracer::start(tracePath);
+    TraceGameScope traceScope{controller.getTraceGameId()};
+
+    auto render = [&] {
+        PhaseTimer timer{&turnStats, StatPhase::Render};
+        disp.printGameBoard(board, players);
+    };
+
+    render();
 
     while (true) {
         if (players[current]->isBankrupt()) {
@@ -182,9 +194,17 @@ int main(int argc, char* argv[]) {
         std::string command;
         bool rolled = false;
 
-        std::cout << "\nIt's " << p->getName() << "'s turn. Type command: ";
+        // Computer players take the whole turn without commands.
+        const Strategy* bot = controller.getStrategy(p);
+        if (bot) {
+            std::cout << "\nIt's " << p->getName() << "'s turn (" << bot->name() << ").\n";
+            controller.playBotTurn(p);
+            render();
+        } else {
+            std::cout << "\nIt's " << p->getName() << "'s turn. Type command: ";
+        }
 
-        while (true) {
+        while (!bot) {
             std::cin >> command;
 
             if (command == "roll" && !rolled) {
@@ -202,7 +222,7 @@ int main(int argc, char* argv[]) {
                     controller.playTurn(p);
                 }
                 rolled = true;
-                disp.printGameBoard(board, players);
+                render();
                 break;
             } else if (command == "next" && rolled) {
                 break;
@@ -232,6 +252,19 @@ int main(int argc, char* argv[]) {
                     controller.printAssets(player);
                     std::cout << "\n";
                 }
+            } else if (command == "risk") {
+                printRiskMap(std::cout, assessTurn(controller, board, p), board.getDefinition());
+            } else if (command == "odds") {
+                // Optional budget in milliseconds ("odds 500").
+                std::string rest;
+                std::getline(std::cin, rest);
+                std::istringstream iss(rest);
+                OddsConfig odds;
+                int milliseconds;
+                if (iss >> milliseconds && milliseconds > 0) odds.seconds = milliseconds / 1000.0;
+                printOdds(std::cout, estimateOdds(game, p, odds));
+            } else if (command == "stats") {
+                turnStats.print(std::cout);
             } else if (command == "bankrupt") {
                 controller.declareBankruptcy(p, nullptr);
                 break;
@@ -244,47 +277,7 @@ int main(int argc, char* argv[]) {
                     continue;
                 }
 
-                // Save players
-                out << players.size() << "\n";
-                for (auto* pl : players) {
-                    out << pl->getName() << " "
-                        << pl->getToken() << " "
-                        << pl->getRollUpCups() << " "
-                        << pl->getMoney() << " "
-                        << pl->getPosition();
-
-                    if (pl->getPosition() == 10 && pl->isInTims()) {
-                        out << " 1 " << pl->getTimsTurns();
-                    }
-
-                    out << "\n";
-                }
-
-                // Save buildings
-                for (int i = 0; i < 40; ++i) {
-                    auto* b = board.getSquare(i);
-                    auto* building = dynamic_cast<Building*>(b);
-                    if (!building) continue;
-                    if (auto* building = dynamic_cast<Building*>(b)) {
-                        std::string owner = "BANK";
-                        if (!building->getOwnerToken().empty()) {
-                            Player* ownerPlayer = controller.getPlayer(building->getOwnerToken());
-                            if (ownerPlayer) {
-                                owner = ownerPlayer->getName();
-                            }
-                        }
-                        int improvements = 0;
-
-                        if (building->isMortgaged()) {
-                            improvements = -1;
-                        } else if (auto* ab = dynamic_cast<AcademicBuilding*>(building)) {
-                            improvements = ab->getImprovementCount();
-                        }
-
-                        out << building->getName() << " " << owner << " " << improvements << "\n";
-                    }           
-                }
-
+                writeSaveFile(out, players, board, controller);
                 std::cout << "[✓] Game saved to: " << filename << "\n";
             } else {
                 std::cout << "Unknown or invalid command. Try again.\n";
@@ -310,6 +303,13 @@ int main(int argc, char* argv[]) {
         current = (current + 1) % players.size();
     }
 
-    for (auto* p : players) delete p;
+    if (turnStatsEnabled) turnStats.print(std::cout);
+    if (!analyticsPath.empty()) {
+        std::ofstream csv(analyticsPath);
+        if (csv) writeAnalyticsCsv(csv, analytics, board.getDefinition());
+        else std::cerr << "Error writing to file: " << analyticsPath << "\n";
+    }
+    controller.setSpectator(nullptr);
+    delete spectator;
     return 0;
 }
@@ -4,6 +4,7 @@ import Board;
 import Square;
 import Player;
 import AcademicBuilding;
+import Trace;
 
 import <iostream>;
 import <iomanip>;
@@ -38,6 +39,7 @@ std::string getImprovementString(const Square *sq) {
 }
 
 void new_Display::printGameBoard(const Board &board, const std::vector<Player*> &players) {
+    TraceSpan span{"render", "render"};
 
 
     int improv = 0;
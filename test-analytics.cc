@@ -0,0 +1,97 @@
+// test-analytics.cc
+// Purpose:
+//   Verifies the per-square analytics counters: a scripted game feeds
+//   landings, a purchase, rent, an auction with its clearing price, a
+//   mortgage and a bankruptcy into the attached block; per-thread blocks are
+//   cache-line separated and merge to the batch total; and the CSV export
+//   has one row per square.
+import <iostream>;
+import <sstream>;
+import <string>;
+import <thread>;
+import <vector>;
+import GameAnalytics;
+import Game;
+import GameController;
+import BoardDefinition;
+import Player;
+import Building;
+import TestCheck;
+
+int main() {
+    std::cout << "=== ANALYTICS TEST ===\n\n";
+
+    // === Fed from the controller ===
+    AnalyticsBatch batch{1};
+    AnalyticsBlock& block = batch.block(0);
+    Game game;
+    Player* vyomm = game.addPlayer("Vyomm", "V");
+    Player* bhavish = game.addPlayer("Bhavish", "B");
+    GameController& controller = game.getController();
+    controller.setAnalytics(&block);
+    controller.setAuctionMode(AuctionMode::ProxyEnglish);
+    controller.setProxyBidSource([](const Player* p, const Building*) {
+        return p->getToken() == "B" ? 50 : 30;
+    });
+
+    // Buy ML, decline HH, then give up when the liquidation menu comes up.
+    std::istringstream script{"y\nn\n3\n"};
+    auto* savedCin = std::cin.rdbuf(script.rdbuf());
+    std::cout.setstate(std::ios::failbit);
+    controller.simulateTurn(vyomm, 1, 2);    // 3: ML, bought
+    controller.simulateTurn(bhavish, 1, 2);  // 3: ML, rent $4 to Vyomm
+    controller.simulateTurn(vyomm, 2, 4);    // 9: HH, declined; Bhavish wins at $31
+    controller.mortgageBuilding(vyomm, controller.getBuilding("ML"));
+    bhavish->setMoney(0);
+    controller.enforcePayment(bhavish, 100); // bankrupt while standing on ML
+    std::cout.clear();
+    std::cin.rdbuf(savedCin);
+
+    const SquareCounters& ml = block.squares[3];
+    const SquareCounters& hh = block.squares[9];
+    check("Turns counted", block.turns == 3);
+    check("Landings counted per square", ml.landings == 2 && hh.landings == 1 && block.squares[0].landings == 0);
+    check("Purchase counted", ml.purchases == 1 && hh.purchases == 0);
+    check("Rent counted with amount", ml.rentPayments == 1 && ml.rentCollected == 4);
+    check("Auction counted with clearing price", hh.auctions == 1 && hh.auctionTotal == 31 && hh.auctionMax == 31);
+    check("Mortgage counted", ml.mortgages == 1);
+    check("Bankruptcy counted where it was triggered", ml.bankruptcies == 1 && bhavish->isBankrupt());
+
+    // === Per-thread blocks ===
+    AnalyticsBatch workers{4};
+    check("Blocks are cache-line aligned", alignof(AnalyticsBlock) == 64 && sizeof(AnalyticsBlock) % 64 == 0);
+    std::vector<std::thread> pool;
+    for (int t = 0; t < workers.threads(); ++t) {
+        pool.emplace_back([&workers, t] {
+            AnalyticsBlock& mine = workers.block(t);
+            for (int i = 0; i < 100000; ++i) {
+                ++mine.squares[i % 40].landings;
+                ++mine.turns;
+            }
+            mine.squares[5].auctionMax = 100 * (t + 1);
+        });
+    }
+    for (auto& th : pool) th.join();
+    AnalyticsBlock total = workers.merge();
+    check("Merged landings are the sum over threads", total.squares[0].landings == 4 * 2500 && total.turns == 400000);
+    check("Merged auction max is the max over threads", total.squares[5].auctionMax == 400);
+
+    // === CSV ===
+    std::ostringstream csv;
+    writeAnalyticsCsv(csv, batch.merge(), standardBoardDefinition());
+    std::istringstream lines{csv.str()};
+    std::string header, line;
+    std::getline(lines, header);
+    int rows = 0;
+    std::string mlRow;
+    while (std::getline(lines, line)) {
+        ++rows;
+        if (line.rfind("3,", 0) == 0) mlRow = line;
+    }
+    std::cout << "  " << header << "\n  " << mlRow << "\n";
+    check("CSV has a header and one row per square", header.rfind("position,name,kind,landings", 0) == 0 && rows == 40);
+    check("CSV row carries the counters", mlRow == "3,ML,academic,2,0.666667,1,4,1,0,0,0,0,1,1");
+
+    std::cout << "\n=== END OF TEST ===\n";
+    return 0;
+}
@@ -9,7 +9,6 @@ import <vector>;
 void setupProperty(GameController& gc, Player* p, const std::string& name, int improveCount = 0) {
     auto* b = gc.getBuilding(name);
     b->setOwnerToken(p->getToken());
-    p->addProperty(name);
     for (int i = 0; i < improveCount; ++i) {
         gc.improveBuilding(p, dynamic_cast<AcademicBuilding*>(b));
     }
@@ -0,0 +1,220 @@
+// test-batch.cc
+// Purpose:
+//   Verifies BatchEngine against the scalar engine. Lanes and Games seeded
+//   alike (every seat always-buy, proxy English auctions) must agree on
+//   every position, balance, Tims line state and owner after every turn,
+//   up to the turn in which a lane stops, and a lane may only stop in a
+//   turn where its Game had to raise funds; that holds for tokens in seat
+//   order and for G, B, D, P given to setTokens. amountDue must match what
+//   GameController::playTurn charges for random ownership states
+//   (monopolies, residence and gym counts, owners in the Tims line),
+//   Tuition and the Coop Fee.
+import <array>;
+import <iostream>;
+import <memory>;
+import <random>;
+import <stdexcept>;
+import <string>;
+import <vector>;
+import BatchEngine;
+import Game;
+import GameController;
+import Board;
+import BoardDefinition;
+import Building;
+import Player;
+import Strategy;
+import TestCheck;
+
+constexpr int TableSeats = 4;
+constexpr int Lanes = 48;
+using Tokens = std::array<std::string, TableSeats>;
+static const Tokens tokens{"B", "D", "G", "P"};
+
+static std::unique_ptr<Game> makeGame(unsigned seed, const Tokens& seatTokens) {
+    auto game = std::make_unique<Game>();
+    for (int s = 0; s < TableSeats; ++s) {
+        Player* p = game->addPlayer("Seat" + std::to_string(s + 1), seatTokens[s]);
+        game->getController().setStrategy(p, findStrategy("always-buy"));
+    }
+    game->getController().setAuctionMode(AuctionMode::ProxyEnglish);
+    game->getController().seed(seed);
+    return game;
+}
+
+static int seatOf(Game& game, const Player* p) {
+    for (int s = 0; s < TableSeats; ++s) {
+        if (game.getPlayer(s) == p) return s;
+    }
+    return -1;
+}
+
+static bool sameState(const BatchEngine& batch, int lane, Game& game) {
+    for (int s = 0; s < TableSeats; ++s) {
+        const Player* p = game.getPlayer(s);
+        if (p->getPosition() != batch.position(lane, s) || p->getMoney() != batch.money(lane, s) ||
+            p->isInTims() != batch.inTims(lane, s) || p->getTimsTurns() != batch.timsTurns(lane, s)) {
+            return false;
+        }
+    }
+    for (int pos = 0; pos < BoardDefinition::Squares; ++pos) {
+        auto* b = dynamic_cast<Building*>(game.getBoard().getSquare(pos));
+        int owner = b && b->getOwner() ? seatOf(game, b->getOwner()) : -1;
+        if (owner != batch.owner(lane, pos)) return false;
+    }
+    return true;
+}
+
+// What raising funds leaves behind: a mortgage, or a bankruptcy.
+static bool raisedFunds(Game& game) {
+    for (int s = 0; s < TableSeats; ++s) {
+        if (game.getPlayer(s)->isBankrupt()) return true;
+    }
+    for (int pos = 0; pos < BoardDefinition::Squares; ++pos) {
+        auto* b = dynamic_cast<Building*>(game.getBoard().getSquare(pos));
+        if (b && b->isMortgaged()) return true;
+    }
+    return false;
+}
+
+struct Lockstep {
+    int compared = 0;
+    int mismatches = 0;
+    int stops = 0;
+    int stopsExplained = 0;
+    int playing = 0;
+    bool sawMinusOne = false;
+};
+
+// Lanes against Games seated with seatTokens, turn by turn.
+static Lockstep playLockstep(const Tokens& seatTokens) {
+    const int Turns = 300;
+    const unsigned FirstSeed = 1;
+    BatchEngine batch{Lanes, TableSeats, FirstSeed};
+    batch.setTokens(seatTokens);
+    std::vector<std::unique_ptr<Game>> games;
+    for (int g = 0; g < Lanes; ++g) games.push_back(makeGame(FirstSeed + g, seatTokens));
+
+    std::vector<bool> stopped(Lanes, false);
+    Lockstep run;
+    std::cout.setstate(std::ios::failbit);
+    for (int t = 0; t < Turns; ++t) {
+        batch.playTurn();
+        for (int g = 0; g < Lanes; ++g) {
+            if (stopped[g]) continue;
+            games[g]->getController().playTurn(games[g]->getPlayer(t % TableSeats));
+            if (batch.status(g) == LaneStatus::Shortfall) {
+                stopped[g] = true;
+                ++run.stops;
+                run.stopsExplained += batch.turnsPlayed(g) == t && batch.currentSeat(g) == t % TableSeats &&
+                                      raisedFunds(*games[g]);
+                continue;
+            }
+            ++run.compared;
+            if (!sameState(batch, g, *games[g]) && run.mismatches++ == 0) {
+                std::cout.clear();
+                std::cout << "  first mismatch: lane " << g << " after turn " << t << "\n";
+                std::cout.setstate(std::ios::failbit);
+            }
+            for (int s = 0; s < TableSeats; ++s) run.sawMinusOne = run.sawMinusOne || batch.position(g, s) == -1;
+        }
+    }
+    std::cout.clear();
+    std::cout.width(0);
+    run.playing = batch.playing();
+    return run;
+}
+
+int main() {
+    std::cout << "=== BATCH ENGINE TEST ===\n\n";
+
+    // === Lockstep games against scalar games ===
+    const Lockstep run = playLockstep(tokens);
+    std::cout << "  " << run.compared << " lane-turns compared, " << run.stops << " lanes stopped, "
+              << run.playing << " still playing\n";
+    check("Every lane matches its Game after every turn", run.mismatches == 0);
+    check("Lanes stop only in a turn where the Game raised funds", run.stops == run.stopsExplained);
+    check("Stopped lanes are no longer playing", run.playing == Lanes - run.stops);
+    check("An SLC -3 from square 2 leaves position -1, as Player::move does", run.sawMinusOne);
+
+    // Tokens out of seat order: tied maxima go to the first in token order.
+    const Lockstep shuffled = playLockstep(Tokens{"G", "B", "D", "P"});
+    check("Lanes seated G, B, D, P match their Games",
+          shuffled.mismatches == 0 && shuffled.stops == shuffled.stopsExplained);
+
+    // === Amount due against the scalar rent code ===
+    Game table;
+    for (int s = 0; s < TableSeats; ++s) table.addPlayer("Seat" + std::to_string(s + 1), tokens[s]);
+    for (int s = 0; s < TableSeats; ++s) table.getController().setStrategy(table.getPlayer(s), findStrategy("always-buy"));
+    BatchEngine one{1, TableSeats, 1};
+    const BoardDefinition& def = standardBoardDefinition();
+    std::mt19937 rng{7};
+    int trials = 0, wrong = 0;
+    std::cout.setstate(std::ios::failbit);
+    while (trials < 400) {
+        for (int pos = 0; pos < BoardDefinition::Squares; ++pos) {
+            auto* b = dynamic_cast<Building*>(table.getBoard().getSquare(pos));
+            if (!b) continue;
+            int owner = static_cast<int>(rng() % 6) - 2;  // one in three: the Bank
+            b->setOwner(owner >= 0 ? table.getPlayer(owner) : nullptr);
+            one.setOwner(0, pos, std::max(owner, -1));
+        }
+        for (int s = 0; s < TableSeats; ++s) {
+            bool inLine = rng() % 4 == 0;
+            table.getPlayer(s)->setInTims(inLine);
+            one.setInTims(0, s, inLine);
+        }
+
+        int square = static_cast<int>(rng() % BoardDefinition::Squares);
+        SquareKind kind = def.squares[square].kind;
+        bool building = kind == SquareKind::Academic || kind == SquareKind::Residence || kind == SquareKind::Gym;
+        if (!(building && one.owner(0, square) >= 0) && kind != SquareKind::Tuition && kind != SquareKind::CoopFee) {
+            continue;
+        }
+        int lander = static_cast<int>(rng() % TableSeats);
+        int d1 = static_cast<int>(rng() % 6) + 1;
+        int d2 = (d1 + static_cast<int>(rng() % 5)) % 6 + 1;  // anything but d1
+        int start = (square - d1 - d2 + BoardDefinition::Squares) % BoardDefinition::Squares;
+        int cash = 500 + static_cast<int>(rng() % 2000);
+        int osap = square < start && square != 0 ? 200 : 0;
+
+        Player* p = table.getPlayer(lander);
+        p->setInTims(false);
+        one.setInTims(0, lander, false);
+        p->moveTo(start);
+        p->setMoney(cash);
+        one.setMoney(0, lander, cash + osap);  // what Tuition sees after the move
+        int owner = building ? one.owner(0, square) : -1;
+        int ownerBefore = owner >= 0 ? table.getPlayer(owner)->getMoney() : 0;
+
+        int due = one.amountDue(0, lander, square, d1 + d2);
+        table.getController().simulateTurn(p, d1, d2);
+        bool ok = p->getMoney() == cash + osap - due;
+        if (owner >= 0 && owner != lander) ok = ok && table.getPlayer(owner)->getMoney() == ownerBefore + due;
+        wrong += !ok;
+        ++trials;
+    }
+    std::cout.clear();
+    std::cout.width(0);
+    check("amountDue matches playTurn's rent, Tuition and Coop Fee", wrong == 0);
+
+    // === Setup errors ===
+    bool threw = false;
+    try {
+        BatchEngine tooFew{4, 1, 1};
+    } catch (const std::invalid_argument&) {
+        threw = true;
+    }
+    check("A batch game needs two seats", threw);
+
+    threw = false;
+    try {
+        one.setOwner(0, 0, 1);
+    } catch (const std::invalid_argument&) {
+        threw = true;
+    }
+    check("Only buildings have owners", threw);
+
+    std::cout << "\n=== END OF TEST ===\n";
+    return 0;
+}
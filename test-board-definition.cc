@@ -0,0 +1,171 @@
+// test-board-definition.cc
+// Purpose:
+//   Verifies data-driven boards: standard.board compiles to exactly the
+//   built-in definition, a modified definition changes rent, residence,
+//   gym, Needles Hall and SLC behaviour through the normal turn flow, two
+//   boards on one definition share its static data but not their state,
+//   and malformed board files are rejected with a useful message.
+import <cstdio>;
+import <fstream>;
+import <iostream>;
+import <sstream>;
+import <stdexcept>;
+import <string>;
+import GameController;
+import Board;
+import BoardDefinition;
+import Player;
+import Building;
+import AcademicBuilding;
+import Residence;
+import Gym;
+import TestCheck;
+
+// Writes `text` to a scratch board file and returns the loader's error
+// message ("" if it loaded).
+static std::string loadError(const std::string& text) {
+    const std::string path = "test-board-definition.tmp";
+    {
+        std::ofstream out(path);
+        out << text;
+    }
+    std::string error;
+    try {
+        loadBoardDefinition(path);
+    } catch (const std::runtime_error& e) {
+        error = e.what();
+    }
+    std::remove(path.c_str());
+    return error;
+}
+
+// standard.board with one line replaced (or removed when `with` is empty).
+static std::string standardWith(const std::string& prefix, const std::string& with) {
+    std::ifstream in("standard.board");
+    std::ostringstream out;
+    std::string line;
+    while (std::getline(in, line)) {
+        if (line.rfind(prefix, 0) == 0) {
+            if (!with.empty()) out << with << "\n";
+        } else {
+            out << line << "\n";
+        }
+    }
+    return out.str();
+}
+
+int main() {
+    std::cout << "=== BOARD DEFINITION TEST ===\n\n";
+
+    // === The shipped file is the built-in board ===
+    BoardDefinition loaded = loadBoardDefinition("standard.board");
+    check("standard.board equals the built-in definition", loaded == standardBoardDefinition());
+    check("SLC table has 24 slots", loaded.slc.totalWeight() == 24);
+    check("Needles Hall table has 18 slots", loaded.needlesHall.totalWeight() == 18);
+
+    // === A variant changes behaviour through the engine ===
+    BoardDefinition variant = standardBoardDefinition();
+    variant.squares[1].name = "ARTS";
+    variant.squares[1].rent = {5, 25, 75, 225, 400, 625};
+    variant.residenceRent = {0, 40, 80, 160, 320};
+    variant.gymMultiplier = {0, 4, 10};
+    variant.needlesHall = {};
+    variant.needlesHall.add(75, 1);
+    variant.slc = {};
+    variant.slc.add({SlcEffect::Move, 1}, 1);
+    variant.compile();
+
+    Board board{variant};
+    GameController controller;
+    controller.setBoard(&board);
+    Player* vyomm = new Player("Vyomm", "V");
+    Player* bhavish = new Player("Bhavish", "B");
+    controller.addPlayer(vyomm);
+    controller.addPlayer(bhavish);
+
+    auto* arts = dynamic_cast<AcademicBuilding*>(board.getSquareByName("ARTS"));
+    check("Renamed square resolves by name", arts && arts->getPosition() == 1);
+    check("Old name no longer resolves", board.getSquareByName("AL") == nullptr);
+    check("Rent ladder comes from the definition",
+          arts && arts->rentAtLevel(0, false) == 5 && arts->rentAtLevel(3, false) == 225 &&
+          arts->rentAtLevel(0, true) == 10);
+
+    auto* mkv = dynamic_cast<Residence*>(board.getSquareByName("MKV"));
+    check("Residence rent comes from the definition",
+          mkv && mkv->calculateRent(1) == 40 && mkv->calculateRent(4) == 320);
+    auto* pac = dynamic_cast<Gym*>(board.getSquareByName("PAC"));
+    check("Gym multipliers come from the definition",
+          pac && pac->getMultiplier(1) == 4 && pac->getMultiplier(2) == 10);
+
+    std::cout.setstate(std::ios::failbit);
+    // Gym rent: Bhavish owns PAC, Vyomm rolls 1+2 from 9.
+    pac->setOwner(bhavish);
+    vyomm->setMoney(1000);
+    vyomm->moveTo(9);
+    controller.simulateTurn(vyomm, 1, 2);
+    int afterGym = vyomm->getMoney();
+
+    // Needles Hall: 19 + 3 = 22.
+    vyomm->moveTo(19);
+    controller.simulateTurn(vyomm, 1, 2);
+    int afterNeedles = vyomm->getMoney();
+
+    // SLC: 29 + 4 = 33, then the only outcome is +1 (onto Bhavish's C2).
+    dynamic_cast<Building*>(board.getSquareByName("C2"))->setOwner(bhavish);
+    vyomm->moveTo(29);
+    controller.simulateTurn(vyomm, 3, 1);
+    std::cout.clear();
+
+    check("Gym rent uses the multiplier (4 x 3)", afterGym == 1000 - 12);
+    check("Needles Hall draws from the definition", afterNeedles == afterGym + 75);
+    check("SLC draws from the definition", vyomm->getPosition() == 34);
+
+    // === Games share the definition, not the state ===
+    Board other{variant};
+    auto* otherArts = dynamic_cast<AcademicBuilding*>(other.getSquareByName("ARTS"));
+    check("Boards share one copy of the static data",
+          &otherArts->getName() == &arts->getName() && &other.getDefinition() == &board.getDefinition());
+    check("Boards keep separate owners", !otherArts->getOwner() && pac->getOwner() == bhavish &&
+                                         !dynamic_cast<Building*>(other.getSquareByName("PAC"))->getOwner());
+
+    // === Malformed files are rejected ===
+    std::string error;
+    error = loadError(standardWith("square 5 ", ""));
+    std::cout << "  missing square: " << error << "\n";
+    check("Missing square rejected", error.find("square 5") != std::string::npos);
+
+    error = loadError(standardWith("square 2 ", "square 2 bank SLC"));
+    std::cout << "  bad kind: " << error << "\n";
+    check("Unknown kind rejected with line number",
+          error.find("unknown square kind") != std::string::npos &&
+          error.find(".tmp:20:") != std::string::npos);
+
+    error = loadError(standardWith("square 0 ", "square 0 goose \"COLLECT OSAP\""));
+    check("Position 0 must be Collect OSAP", error.find("Collect OSAP") != std::string::npos);
+
+    error = loadError(standardWith("square 1 ", "square 1 academic AL 40 Arts1 50 2 10 30 20 160 250"));
+    check("Decreasing rent ladder rejected", error.find("decrease") != std::string::npos);
+
+    error = loadError(standardWith("square 3 ", "square 3 academic AL 60 Arts1 50 4 20 60 180 320 450"));
+    check("Duplicate property name rejected", error.find("duplicate") != std::string::npos);
+
+    error = loadError(standardWith("square 1 ", "square 1 academic AL 40 Arts1 50 2 10 30"));
+    check("Short rent ladder rejected", error.find("6 rent values") != std::string::npos);
+
+    error = loadError(standardWith("gym-multiplier", "gym-bonus 1 2"));
+    check("Unknown record rejected", error.find("unknown record") != std::string::npos);
+
+    error = loadError(standardWith("slc move 3", "slc move 0 4"));
+    check("Zero SLC move rejected", error.find("SLC move") != std::string::npos);
+
+    // Rules a variant leaves out fall back to the standard board's.
+    error = loadError(standardWith("needles", ""));
+    check("Omitted Needles Hall table defaults to standard", error.empty());
+
+    error = loadError("");
+    check("Empty file rejected", !error.empty());
+
+    delete vyomm;
+    delete bhavish;
+    return 0;
+}
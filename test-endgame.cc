@@ -0,0 +1,159 @@
+// test-endgame.cc
+// Purpose:
+//   Verifies the two-player endgame solver (EndgameSolver). On a small
+//   position (a monopoly to build on, one property each to mortgage) the
+//   root moves must be exactly the legal ones, best first, with win
+//   probabilities in [0, 1]; a search must give the same moves and
+//   probabilities on one thread and on four (node counts may differ),
+//   over one turn and over two (the root player in the Tims line, so the
+//   tree stays small), and leave the game untouched. Dice and card rolls
+//   given with setNextDice and setNextDraw must be the ones played. An
+//   overwhelming position scores above one half, a tiny time budget
+//   reports an incomplete search, and anything but two players left is
+//   rejected.
+import <iostream>;
+import <stdexcept>;
+import <string>;
+import <utility>;
+import Game;
+import GameController;
+import Player;
+import EndgameSolver;
+import TestCheck;
+
+static bool hasMove(const EndgameResult& result, EndgameMoveKind kind, const std::string& building) {
+    for (const auto& [move, value] : result.moves) {
+        if (move.kind == kind && move.building == building) return true;
+    }
+    return false;
+}
+
+int main() {
+    std::cout << "=== ENDGAME SOLVER TEST ===\n\n";
+
+    Game game;
+    GameController& controller = game.getController();
+    Player* alice = game.addPlayer("Alice", "A", 400);
+    Player* bob = game.addPlayer("Bob", "B", 300);
+    controller.getBuilding("AL")->setOwner(alice);
+    controller.getBuilding("ML")->setOwner(alice);
+    controller.getBuilding("PAC")->setOwner(bob);
+    controller.recalculateAssets();
+    std::cout.setstate(std::ios::failbit);
+    alice->moveTo(5);
+    bob->moveTo(20);
+    std::cout.clear();
+
+    const auto before = controller.stateHash();
+    EndgameConfig config;
+    config.depth = 1;
+    config.seconds = 0;
+    config.threads = 1;
+    EndgameResult one = solveEndgame(game, alice, config);
+    config.threads = 4;
+    EndgameResult four = solveEndgame(game, alice, config);
+
+    std::cout << "  depth " << one.depth << ", " << one.nodes << " nodes, " << one.tableHits << " table hits\n";
+    for (const auto& [move, value] : one.moves) std::cout << "  " << describe(move) << ": " << value << "\n";
+    check("Solving changes nothing", controller.stateHash() == before);
+    check("The search is complete", one.complete && one.depth == 1);
+    check("Roll, improve and mortgage are offered",
+          hasMove(one, EndgameMoveKind::None, "") && hasMove(one, EndgameMoveKind::Improve, "AL") &&
+              hasMove(one, EndgameMoveKind::Improve, "ML") && hasMove(one, EndgameMoveKind::Mortgage, "AL"));
+    check("Nothing illegal is offered", one.moves.size() == 5 && !hasMove(one, EndgameMoveKind::Degrade, "AL") &&
+                                            !hasMove(one, EndgameMoveKind::Unmortgage, "ML"));
+    bool sorted = true, inRange = true;
+    for (std::size_t i = 0; i < one.moves.size(); ++i) {
+        inRange = inRange && one.moves[i].second >= 0 && one.moves[i].second <= 1;
+        if (i > 0) sorted = sorted && one.moves[i - 1].second >= one.moves[i].second;
+    }
+    check("Moves are sorted best first, in [0, 1]", sorted && inRange);
+    check("The best move leads the list", one.best == one.moves.front().first &&
+                                              one.winProbability == one.moves.front().second);
+    check("Win probabilities add up to one", one.winProbability + one.opponentWinProbability == 1);
+    check("One thread and four agree", one.moves == four.moves);
+
+    // === Two turns: the opponent minimises ===
+    Game line;
+    Player* dee = line.addPlayer("Dee", "D", 40);
+    line.addPlayer("Eve", "E", 300);
+    std::cout.setstate(std::ios::failbit);
+    dee->moveTo(10);
+    std::cout.clear();
+    dee->setInTims(true);
+    config.depth = 2;
+    config.threads = 1;
+    EndgameResult lineOne = solveEndgame(line, dee, config);
+    config.threads = 4;
+    EndgameResult lineFour = solveEndgame(line, dee, config);
+    std::cout << "  depth " << lineOne.depth << ", " << lineOne.nodes << " nodes, roll: " << lineOne.winProbability
+              << "\n";
+    check("A two-turn search is complete", lineOne.complete && lineOne.depth == 2 && lineOne.moves.size() == 1);
+    check("One thread and four agree over two turns", lineOne.moves == lineFour.moves);
+
+    // === Dice and card rolls given to the controller ===
+    Game given;
+    Player* ann = given.addPlayer("Ann", "A");
+    given.addPlayer("Bo", "B");
+    GameController& stepper = given.getController();
+    std::cout.setstate(std::ios::failbit);
+    ann->moveTo(5);
+    stepper.beginTurn(ann);
+    stepper.setNextDice(std::pair{1, 1});
+    stepper.setNextDraw(0);  // the first Needles Hall slot: -$200
+    stepper.stepTurn();
+    stepper.stepTurn();
+    const TurnPhase afterResolve = stepper.stepTurn();
+    std::cout.clear();
+    check("Given dice and draws are played once", ann->getPosition() == 7 && ann->getMoney() == 1300 &&
+                                                      afterResolve == TurnPhase::ExtraTurn &&
+                                                      !stepper.getTurnState().nextDice &&
+                                                      !stepper.getTurnState().nextDraw);
+
+    // === An overwhelming position ===
+    Game rich;
+    Player* tycoon = rich.addPlayer("Tycoon", "T", 5000);
+    Player* pauper = rich.addPlayer("Pauper", "P", 20);
+    for (const char* name : {"EV1", "EV2", "EV3", "PHYS", "B1", "B2", "MKV", "UWP"}) {
+        rich.getController().getBuilding(name)->setOwner(tycoon);
+    }
+    rich.getController().recalculateAssets();
+    config.depth = 1;
+    config.threads = 0;
+    EndgameResult winning = solveEndgame(rich, pauper, config);
+    std::cout << "  pauper " << winning.winProbability << ", tycoon " << winning.opponentWinProbability << "\n";
+    check("An overwhelming position wins for the stronger player", winning.opponentWinProbability > 0.5);
+
+    // === Time budget ===
+    config.depth = 6;
+    config.seconds = 1e-6;
+    EndgameResult rushed = solveEndgame(game, bob, config);
+    check("A tiny budget does not finish", !rushed.complete && rushed.depth < 6);
+    check("An unfinished search still gives probabilities",
+          rushed.winProbability >= 0 && rushed.winProbability <= 1 &&
+              (rushed.moves.empty() || rushed.best == rushed.moves.front().first));
+
+    // === Rejected positions ===
+    Game crowd;
+    Player* first = crowd.addPlayer("One", "1");
+    crowd.addPlayer("Two", "2");
+    crowd.addPlayer("Three", "3");
+    bool threw = false;
+    try {
+        solveEndgame(crowd, first);
+    } catch (const std::invalid_argument&) {
+        threw = true;
+    }
+    check("Three players left is rejected", threw);
+    crowd.getPlayer(2)->setBankrupt(true);
+    threw = false;
+    try {
+        solveEndgame(crowd, crowd.getPlayer(2));
+    } catch (const std::invalid_argument&) {
+        threw = true;
+    }
+    check("A bankrupt player cannot be solved for", threw);
+
+    std::cout << "\n=== END OF TEST ===\n";
+    return 0;
+}
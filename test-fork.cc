@@ -0,0 +1,151 @@
+// test-fork.cc
+// Purpose:
+//   Verifies Game::fork(): a fork starts as an exact copy of a running game
+//   (players, owners, improvements, mortgages, the turn in progress and the
+//   RNG state), plays out identically to its parent from the same position,
+//   and afterwards shares no mutable state with it.
+import <iostream>;
+import <sstream>;
+import <string>;
+import <thread>;
+import <vector>;
+import <memory>;
+import Game;
+import GameController;
+import Board;
+import Player;
+import Building;
+import AcademicBuilding;
+import TestCheck;
+
+// Everything observable about a game, as text.
+static std::string snapshot(Game& game) {
+    std::ostringstream out;
+    for (auto* p : game.getPlayers()) {
+        out << p->getToken() << " $" << p->getMoney() << " @" << p->getPosition()
+            << (p->isInTims() ? " tims" : "") << (p->isBankrupt() ? " out" : "")
+            << " worth " << p->getNetWorth() << "\n";
+    }
+    for (int i = 0; i < 40; ++i) {
+        auto* b = dynamic_cast<Building*>(game.getBoard().getSquare(i));
+        if (!b) continue;
+        out << b->getName() << ":" << (b->getOwner() ? b->getOwner()->getToken() : "-");
+        if (auto* ab = dynamic_cast<AcademicBuilding*>(b)) out << ab->getImprovementCount();
+        if (b->isMortgaged()) out << "m";
+        out << " ";
+    }
+    return out.str();
+}
+
+// Random turns for every player in order (no prompts: everything is owned).
+static void playRounds(Game& game, int rounds) {
+    for (int r = 0; r < rounds; ++r) {
+        for (auto* p : game.getPlayers()) {
+            if (!p->isBankrupt()) game.getController().playTurn(p);
+        }
+    }
+}
+
+int main() {
+    std::cout << "=== GAME FORK TEST ===\n\n";
+
+    // Console input is never needed below; make any stray prompt fail fast.
+    std::istringstream noInput;
+    auto* savedCin = std::cin.rdbuf(noInput.rdbuf());
+    std::cout.setstate(std::ios::failbit);
+
+    Game game;
+    game.getController().seed(246);
+    Player* vyomm = game.addPlayer("Vyomm", "V", 1000000);
+    Player* bhavish = game.addPlayer("Bhavish", "B", 1000000);
+    Player* chris = game.addPlayer("Chris", "C", 1000000);
+    std::vector<Player*> owners{vyomm, bhavish, chris};
+
+    // Every building owned, so no turn can stop at a purchase prompt.
+    int next = 0;
+    for (int i = 0; i < 40; ++i) {
+        if (auto* b = dynamic_cast<Building*>(game.getBoard().getSquare(i))) {
+            b->setOwner(owners[next++ % 3]);
+        }
+    }
+    auto* al = dynamic_cast<AcademicBuilding*>(game.getController().getBuilding("AL"));
+    auto* ml = dynamic_cast<AcademicBuilding*>(game.getController().getBuilding("ML"));
+    al->setOwner(vyomm);
+    ml->setOwner(vyomm);
+    game.getController().getBuilding("MKV")->setOwner(bhavish);
+    game.getController().improveBuilding(vyomm, al);
+    game.getController().mortgageBuilding(bhavish, game.getController().getBuilding("MKV"));
+    playRounds(game, 5);
+
+    // === A fork is an exact copy ===
+    std::unique_ptr<Game> fork = game.fork();
+    std::cout.clear();
+    check("Fork has the same players and board", snapshot(*fork) == snapshot(game));
+    check("Fork has its own players", fork->getPlayer(0) != vyomm && fork->playerCount() == 3);
+    auto* forkAl = dynamic_cast<AcademicBuilding*>(fork->getController().getBuilding("AL"));
+    check("Fork's buildings are owned by the fork's players",
+          forkAl->getOwner() == fork->getPlayer(0) && al->getOwner() == vyomm);
+    check("Fork keeps improvements and mortgages",
+          forkAl->getImprovementCount() == 1 &&
+          fork->getController().getBuilding("MKV")->isMortgaged());
+    check("Fork's owner table resolves tokens to the fork's players",
+          fork->getBoard().getOwnership().findPlayer("B") == fork->getPlayer(1));
+
+    // === Same RNG state: identical futures ===
+    std::cout.setstate(std::ios::failbit);
+    playRounds(game, 20);
+    playRounds(*fork, 20);
+    std::cout.clear();
+    check("Parent and fork play out identically", snapshot(*fork) == snapshot(game));
+
+    // === A turn in progress forks too ===
+    std::cout.setstate(std::ios::failbit);
+    game.getController().beginTurn(chris);
+    game.getController().stepTurn();  // dice are rolled
+    std::unique_ptr<Game> midTurn = game.fork();
+    int forkDie1 = midTurn->getController().getTurnState().die1;
+    while (game.getController().stepTurn() != TurnPhase::Done) {}
+    while (midTurn->getController().stepTurn() != TurnPhase::Done) {}
+    std::cout.clear();
+    check("Turn state is copied", forkDie1 == game.getController().getTurnState().die1 &&
+                                  midTurn->getController().getTurnState().player == midTurn->getPlayer(2));
+    check("Mid-turn fork finishes the same turn", snapshot(*midTurn) == snapshot(game));
+
+    // === Independent afterwards ===
+    std::string before = snapshot(game);
+    std::cout.setstate(std::ios::failbit);
+    fork->getPlayer(0)->setMoney(5);
+    fork->getController().degradeBuilding(fork->getPlayer(0), forkAl);
+    forkAl->setOwner(fork->getPlayer(2));
+    std::cout.clear();
+    check("Changing a fork leaves the parent untouched", snapshot(game) == before);
+
+    std::unique_ptr<Game> other = game.fork();
+    other->getController().seed(2);
+    std::cout.setstate(std::ios::failbit);
+    std::unique_ptr<Game> same = game.fork();
+    same->getController().seed(1);
+    playRounds(*other, 10);
+    playRounds(*same, 10);
+    std::unique_ptr<Game> reseeded = game.fork();
+    reseeded->getController().seed(1);
+    playRounds(*reseeded, 10);
+    std::cout.clear();
+    check("Forks reseeded alike agree", snapshot(*same) == snapshot(*reseeded));
+    check("Forks reseeded differently diverge", snapshot(*same) != snapshot(*other));
+
+    // === Many forks of one position, taken concurrently ===
+    std::vector<std::unique_ptr<Game>> futures(8);
+    std::vector<std::thread> pool;
+    for (int t = 0; t < 8; ++t) {
+        pool.emplace_back([&, t] { futures[t] = game.fork(); });
+    }
+    for (auto& th : pool) th.join();
+    bool allEqual = true;
+    for (auto& f : futures) allEqual = allEqual && snapshot(*f) == snapshot(game);
+    check("Concurrent forks of one game are all exact copies", allEqual);
+
+    std::cin.rdbuf(savedCin);
+    std::cout << "\n=== END OF TEST ===\n";
+    return 0;
+}
@@ -26,7 +26,6 @@ int main() {
     // Set up true monopoly for Vyomm
     for (auto* ab : {ev1, ev2, ev3}) {
         ab->setOwnerToken(vyomm->getToken());
-        vyomm->addProperty(ab->getName());
     }
 
     // ----- CASE 1: Valid Improvement -----
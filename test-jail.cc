@@ -29,7 +29,6 @@ int main() {
     controller.addPlayer(bhavish);
     auto* b2 = dynamic_cast<AcademicBuilding*>(board->getSquareByName("B2"));
     b2->setOwnerToken("B");
-    bhavish->addProperty("B2");
 
     // Move Bhavish to 22 and roll (4,4) to land on 30 and go to jail
     std::cout << "[Setup] Bhavish moves to 22 and rolls (4,4) to land on GO TO TIMS.\n";
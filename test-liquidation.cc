@@ -0,0 +1,89 @@
+// test-liquidation.cc
+// Purpose:
+//   Verifies the automatic liquidation planner picks the improvement sales
+//   and mortgages that cover a debt with the least rent lost, respects the
+//   block rules, reports impossible debts, and that GameController applies
+//   a plan in one batch.
+//
+// Setup: Vyomm owns Arts1 (AL, ML) with 2 improvements each, plus MKV.
+//   AL rent 4/10/30 (0/1/2 impr., monopoly), ML 8/20/60, MKV 25.
+//   Selling an Arts1 improvement refunds $25; mortgaging MKV gives $100.
+import <iostream>;
+import <string>;
+import GameController;
+import Board;
+import Player;
+import AcademicBuilding;
+import Building;
+import Liquidation;
+import TestCheck;
+
+int main() {
+    std::cout << "=== LIQUIDATION PLANNER TEST ===\n\n";
+
+    GameController controller;
+    Board* board = new Board();
+    controller.setBoard(board);
+
+    Player* vyomm = new Player("Vyomm", "V");
+    controller.addPlayer(vyomm);
+
+    auto* al = dynamic_cast<AcademicBuilding*>(board->getSquareByName("AL"));
+    auto* ml = dynamic_cast<AcademicBuilding*>(board->getSquareByName("ML"));
+    auto* mkv = dynamic_cast<Building*>(board->getSquareByName("MKV"));
+    for (auto* b : {static_cast<Building*>(al), static_cast<Building*>(ml), mkv}) {
+        b->setOwner(vyomm);
+    }
+    for (int i = 0; i < 2; ++i) {
+        controller.improveBuilding(vyomm, al);
+        controller.improveBuilding(vyomm, ml);
+    }
+
+    std::cout << "\n-- Case 1: $25 short -> sell one AL improvement --\n";
+    LiquidationPlan small = planLiquidation(vyomm, *board, 25);
+    check("Feasible", small.feasible, 1);
+    check("Actions", small.actions.size(), 1);
+    check("Rent lost", small.rentLost, 20);
+    check("Sells from AL", !small.actions.empty() && small.actions[0].building == al, 1);
+
+    std::cout << "\n-- Case 2: $100 short -> mortgage MKV, keep the houses --\n";
+    LiquidationPlan medium = planLiquidation(vyomm, *board, 100);
+    check("Rent lost", medium.rentLost, 25);
+    check("Mortgages MKV", medium.actions.size() == 1 &&
+                           medium.actions[0].step == LiquidationStep::Mortgage &&
+                           medium.actions[0].building == mkv, 1);
+
+    std::cout << "\n-- Case 3: $150 short -> MKV plus both AL improvements --\n";
+    LiquidationPlan large = planLiquidation(vyomm, *board, 150);
+    check("Cash raised", large.cashRaised, 150);
+    check("Rent lost", large.rentLost, 51);
+
+    std::cout << "\n-- Case 4: more than everything is worth --\n";
+    LiquidationPlan impossible = planLiquidation(vyomm, *board, 10000);
+    check("Feasible", impossible.feasible, 0);
+    check("Actions", impossible.actions.size(), 0);
+
+    std::cout << "\n-- Case 5: $250 short -> strip Arts1, then mortgage everything --\n";
+    LiquidationPlan block = planLiquidation(vyomm, *board, 250);
+    bool salesFirst = true, seenMortgage = false;
+    for (const auto& a : block.actions) {
+        if (a.step == LiquidationStep::Mortgage) seenMortgage = true;
+        else if (seenMortgage) salesFirst = false;
+    }
+    check("Feasible", block.feasible, 1);
+    check("Actions", block.actions.size(), 7);
+    check("Sales ordered before mortgages", salesFirst, 1);
+
+    std::cout << "\n-- Case 6: apply as one batch --\n";
+    vyomm->setMoney(0);
+    bool paid = controller.raiseFundsAutomatically(vyomm, 150);
+    check("Covered the debt", paid, 1);
+    check("Money", vyomm->getMoney(), 150);
+    check("MKV mortgaged", mkv->isMortgaged(), 1);
+    check("AL improvements", al->getImprovementCount(), 0);
+    check("ML improvements", ml->getImprovementCount(), 2);
+
+    delete vyomm;
+    delete board;
+    return 0;
+}
@@ -14,7 +14,7 @@
 //
 // Test Overview:
 //   1. Instantiate two players
-//   2. Instantiate three different building types
+//   2. Look up three different building types on a Board
 //   3. Simulate initial landings on unowned buildings
 //   4. Manually assign ownership to players
 //   5. Simulate landings on owned buildings to verify rent/personal messages
@@ -22,14 +22,18 @@
 
 import <iostream>;
 import Player;
+import Board;
 import AcademicBuilding;
 import Residence;
 import Gym;
 import GameController;
 
 int main() {
-    // Create central controller to manage game logic
+    // Create central controller to manage game logic. Buildings record their
+    // owner in the board's owner table, so they must come from a Board.
+    Board board;
     GameController controller;
+    controller.setBoard(&board);
 
     // Create two test players
     Player* p1 = new Player("Vyomm", "V");   // Player 1, token "V"
@@ -38,14 +42,10 @@ int main() {
     controller.addPlayer(p1);
     controller.addPlayer(p2);
 
-    // Create three types of buildings
-    AcademicBuilding* ev1 = new AcademicBuilding("EV1", 6, 200, "Env", 150);
-    Residence* mkv = new Residence("MKV", 3, 200);
-    Gym* pac = new Gym("PAC", 5, 150);
-
-    controller.addBuilding(ev1);
-    controller.addBuilding(mkv);
-    controller.addBuilding(pac);
+    // Three types of buildings
+    auto* ev1 = dynamic_cast<AcademicBuilding*>(board.getSquareByName("EV1"));
+    auto* mkv = dynamic_cast<Residence*>(board.getSquareByName("MKV"));
+    auto* pac = dynamic_cast<Gym*>(board.getSquareByName("PAC"));
 
     // Simulate landing on unowned buildings
     std::cout << "\n-- Simulating landings (initially unowned) --\n";
@@ -67,9 +67,6 @@ int main() {
     // Clean up heap memory
     delete p1;
     delete p2;
-    delete ev1;
-    delete mkv;
-    delete pac;
 
     return 0;
 }
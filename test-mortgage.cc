@@ -26,7 +26,6 @@ int main() {
     // Give full monopoly to Vyomm
     for (auto* ab : {ev1, ev2, ev3}) {
         ab->setOwnerToken(vyomm->getToken());
-        vyomm->addProperty(ab->getName());
     }
 
     // Case 1: Mortgage with improvements → should fail
@@ -0,0 +1,61 @@
+// test-networth.cc
+// Purpose:
+//   Verifies that each player's running asset totals follow every ownership,
+//   improvement and mortgage change made through GameController, and that
+//   they match a full recalculation from the board.
+import <iostream>;
+import <optional>;
+import <utility>;
+import GameController;
+import Board;
+import Player;
+import AcademicBuilding;
+import TestCheck;
+
+int main() {
+    std::cout << "=== NET WORTH TRACKING TEST ===\n\n";
+
+    GameController controller;
+    Board* board = new Board();
+    controller.setBoard(board);
+
+    Player* vyomm = new Player("Vyomm", "V");
+    Player* bhavish = new Player("Bhavish", "B");
+    controller.addPlayer(vyomm);
+    controller.addPlayer(bhavish);
+
+    // Vyomm buys AL and ML (Arts1) by landing on them.
+    // [input]: y (buy AL), y (buy ML)
+    controller.playTurn(vyomm, std::pair{0, 1});
+    controller.playTurn(vyomm, std::pair{0, 2});
+    check("Property value after buying AL + ML", vyomm->getPropertyValue(), 100, "$");
+
+    auto* al = dynamic_cast<AcademicBuilding*>(board->getSquareByName("AL"));
+    auto* ml = dynamic_cast<AcademicBuilding*>(board->getSquareByName("ML"));
+
+    controller.improveBuilding(vyomm, al);
+    controller.improveBuilding(vyomm, al);
+    check("Improvement value after 2 improvements", vyomm->getImprovementValue(), 100, "$");
+
+    controller.degradeBuilding(vyomm, al);
+    check("Improvement value after selling one", vyomm->getImprovementValue(), 50, "$");
+    controller.degradeBuilding(vyomm, al);
+
+    controller.mortgageBuilding(vyomm, ml);
+    check("Mortgage liability on ML", vyomm->getMortgageLiability(), 33, "$");
+
+    int tracked = vyomm->getNetWorth();
+    controller.recalculateAssets();
+    check("Tracked net worth matches recalculation", tracked, vyomm->getNetWorth(), "$");
+
+    // Bankruptcy to Bhavish moves everything, including the mortgage.
+    controller.declareBankruptcy(vyomm, bhavish);
+    check("Vyomm property value after bankruptcy", vyomm->getPropertyValue(), 0, "$");
+    check("Bhavish property value after bankruptcy", bhavish->getPropertyValue(), 100, "$");
+    check("Bhavish inherits ML's mortgage", bhavish->getMortgageLiability(), 33, "$");
+
+    delete vyomm;
+    delete bhavish;
+    delete board;
+    return 0;
+}
@@ -0,0 +1,114 @@
+// test-odds.cc
+// Purpose:
+//   Verifies the rollout win-probability estimate (WinOdds). With a fixed
+//   number of rollouts the counts must not depend on the number of
+//   threads, every rollout must have exactly one winner, each interval
+//   must contain its estimate, and the game must be left untouched. Human
+//   seats are played by the built-in strategies (std::cin is empty, so any
+//   read would stall the test). A rich player with monopolies must be the
+//   clear favourite, a time budget must be kept (with the rollouts it cuts
+//   off still scored), a cancelled pool must stop at once, and bankrupt
+//   players are left out of the report.
+import <atomic>;
+import <chrono>;
+import <iostream>;
+import <sstream>;
+import <string>;
+import Game;
+import GameController;
+import Player;
+import WinOdds;
+import TestCheck;
+
+int main() {
+    std::cout << "=== WIN ODDS TEST ===\n\n";
+
+    std::istringstream noInput;
+    auto* savedCin = std::cin.rdbuf(noInput.rdbuf());
+
+    Game game;
+    GameController& controller = game.getController();
+    Player* ann = game.addPlayer("Ann", "A");
+    Player* ben = game.addPlayer("Ben", "B");
+    Player* cat = game.addPlayer("Cat", "C");
+
+    const auto before = controller.stateHash();
+    OddsConfig config;
+    config.seconds = 0;
+    config.maxRollouts = 60;
+    config.threads = 1;
+    OddsReport one = estimateOdds(game, ben, config);
+    config.threads = 3;
+    OddsReport three = estimateOdds(game, ben, config);
+    printOdds(std::cout, one);
+
+    check("Estimating changes nothing", controller.stateHash() == before);
+    check("Every rollout is played", one.rollouts == 60 && three.rollouts == 60);
+    long long total = 0;
+    bool same = one.players.size() == 3 && three.players.size() == 3, inside = true;
+    for (std::size_t i = 0; same && i < one.players.size(); ++i) {
+        const PlayerOdds& odds = one.players[i];
+        total += odds.wins;
+        same = same && odds.player == three.players[i].player && odds.wins == three.players[i].wins;
+        inside = inside && 0 <= odds.low && odds.low <= odds.winProbability &&
+                 odds.winProbability <= odds.high && odds.high <= 1;
+    }
+    check("Every rollout has one winner", total == one.rollouts);
+    check("One thread and three agree", same);
+    check("Each interval contains its estimate", inside);
+
+    // === A clear favourite ===
+    for (const char* name : {"EV1", "EV2", "EV3", "PHYS", "B1", "B2", "MKV", "UWP", "V1", "REV", "PAC"}) {
+        controller.getBuilding(name)->setOwner(cat);
+    }
+    cat->setMoney(6000);
+    ann->setMoney(300);
+    ben->setMoney(300);
+    controller.recalculateAssets();
+    config.maxRollouts = 80;
+    config.threads = 0;
+    OddsReport lopsided = estimateOdds(game, ann, config);
+    printOdds(std::cout, lopsided);
+    check("The rich player is the clear favourite",
+          lopsided.players[2].player == cat && lopsided.players[2].low > 0.5);
+
+    // === Budget and cancellation ===
+    config.seconds = 0.05;
+    config.maxRollouts = 0;
+    auto start = std::chrono::steady_clock::now();
+    OddsReport timed = estimateOdds(game, ann, config);
+    const double elapsed = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+    std::cout << "  " << timed.rollouts << " rollouts in " << elapsed << " s\n";
+    check("A 50 ms budget is kept", timed.rollouts > 0 && elapsed < 0.25);
+
+    // Level games with no round limit are still going at the deadline.
+    Game level;
+    level.addPlayer("Dee", "D");
+    level.addPlayer("Eve", "E");
+    OddsConfig endless;
+    endless.seconds = 0.005;
+    endless.maxRounds = 1000000;
+    endless.threads = 1;
+    OddsReport cut = estimateOdds(level, level.getPlayer(0), endless);
+    check("Cut-off rollouts are scored on net worth",
+          cut.rollouts > 0 && cut.decidedOnNetWorth > 0 &&
+              cut.players[0].wins + cut.players[1].wins == cut.rollouts);
+
+    std::atomic<bool> cancel{true};
+    config.seconds = 0;
+    config.cancel = &cancel;
+    OddsReport cancelled = estimateOdds(game, ann, config);
+    check("A cancelled pool plays nothing", cancelled.rollouts == 0 && cancelled.players[0].low == 0 &&
+                                                cancelled.players[0].high == 1);
+
+    ben->setBankrupt(true);
+    config.cancel = nullptr;
+    config.maxRollouts = 10;
+    OddsReport two = estimateOdds(game, ann, config);
+    check("Bankrupt players are left out", two.players.size() == 2 && two.players[1].player == cat &&
+                                               two.players[0].wins + two.players[1].wins == 10);
+
+    std::cin.rdbuf(savedCin);
+    std::cout << "\n=== END OF TEST ===\n";
+    return 0;
+}
@@ -0,0 +1,72 @@
+// test-proxy-auction.cc
+// Purpose:
+//   Verifies proxy-bid auctions: English and second-price settlement of
+//   sealed maxima, deterministic tie-breaks, clamping bids to cash, and a
+//   full auction through GameController with a scripted bid source.
+import <iostream>;
+import <map>;
+import <string>;
+import <vector>;
+import GameController;
+import Player;
+import Board;
+import Building;
+import TestCheck;
+
+int main() {
+    std::cout << "=== PROXY AUCTION TEST ===\n\n";
+
+    // === Settlement rules ===
+    AuctionResult english = GameController::resolveProxyAuction({120, 300, 200}, AuctionMode::ProxyEnglish);
+    check("English winner", english.winner, 1);
+    check("English price (runner-up + 1)", english.price, 201);
+
+    AuctionResult second = GameController::resolveProxyAuction({120, 300, 200}, AuctionMode::ProxySecondPrice);
+    check("Second-price winner", second.winner, 1);
+    check("Second-price price", second.price, 200);
+
+    AuctionResult tie = GameController::resolveProxyAuction({50, 250, 250}, AuctionMode::ProxyEnglish);
+    check("Tie goes to earliest bidder", tie.winner, 1);
+    check("Tie price is the shared maximum", tie.price, 250);
+
+    AuctionResult nobody = GameController::resolveProxyAuction({0, 0}, AuctionMode::ProxySecondPrice);
+    check("No bids: first bidder", nobody.winner, 0);
+    check("No bids: free", nobody.price, 0);
+
+    AuctionResult solo = GameController::resolveProxyAuction({80}, AuctionMode::ProxyEnglish);
+    check("Lone bidder pays nothing", solo.price, 0);
+
+    // === Full auction through the controller ===
+    GameController gc;
+    Board board;
+    gc.setBoard(&board);
+
+    auto* p1 = new Player("Player1", "P1");
+    auto* p2 = new Player("Player2", "P2");
+    auto* p3 = new Player("Player3", "P3");
+    gc.addPlayer(p1);
+    gc.addPlayer(p2);
+    gc.addPlayer(p3);
+
+    // P3 "bids" more than it has; its bid is clamped to its $1500.
+    std::map<std::string, int> script = {{"P1", 400}, {"P2", 900}, {"P3", 5000}};
+    int asked = 0;
+    gc.setAuctionMode(AuctionMode::ProxyEnglish);
+    gc.setProxyBidSource([&](const Player* p, const Building*) {
+        ++asked;
+        return script[p->getToken()];
+    });
+
+    auto* bmh = dynamic_cast<Building*>(board.getSquareByName("BMH"));
+    gc.handleAuction(bmh);
+
+    check("Each bidder asked once", asked, 3);
+    check("P3 owns BMH", bmh->getOwner() == p3, 1);
+    check("P3 paid runner-up + 1", p3->getMoney(), 1500 - 901);
+    check("Others unchanged", p1->getMoney() + p2->getMoney(), 3000);
+
+    delete p1;
+    delete p2;
+    delete p3;
+    return 0;
+}
@@ -31,13 +31,10 @@ int main() {
 
     // Assign ownership of all to Vyomm
     dc->setOwnerToken(p1->getToken());
-    p1->addProperty(dc->getName());
 
     mkv->setOwnerToken(p1->getToken());
-    p1->addProperty(mkv->getName());
 
     pac->setOwnerToken(p1->getToken());
-    p1->addProperty(pac->getName());
 
     // ---------- Simulate Bhavish landing on each ----------
     auto landOn = [&](Square* sqr) {
@@ -0,0 +1,140 @@
+// test-risk.cc
+// Purpose:
+//   Verifies the exact turn risk map (RiskMap). On a mid-game position
+//   (doubled and improved rents, residences, gyms, a mortgaged property
+//   and an owner in the Tims line) the exact expected cash change, the
+//   chance of having to sell or mortgage and every square's landing chance
+//   must agree with 20000 turns actually played from forks of the
+//   position. Exact cases: the third missed roll in the Tims line without
+//   $50 or anything to sell is bankruptcy with probability 5/6, and a
+//   turn's first roll lands somewhere with probability 1. Assessing
+//   changes nothing.
+import <cmath>;
+import <iostream>;
+import <memory>;
+import <random>;
+import <sstream>;
+import <string>;
+import <vector>;
+import Game;
+import GameController;
+import GameAnalytics;
+import Board;
+import BoardDefinition;
+import Building;
+import AcademicBuilding;
+import Liquidation;
+import Player;
+import RiskMap;
+import Strategy;
+import TestCheck;
+
+static void give(GameController& controller, Player* p, const std::vector<std::string>& names) {
+    for (const auto& name : names) controller.getBuilding(name)->setOwner(p);
+}
+
+int main() {
+    std::cout << "=== RISK MAP TEST ===\n\n";
+
+    std::istringstream noInput;
+    auto* savedCin = std::cin.rdbuf(noInput.rdbuf());
+
+    // === A mid-game position, every building owned ===
+    Game game;
+    GameController& controller = game.getController();
+    Player* mover = game.addPlayer("Mover", "M", 100000);
+    Player* sci = game.addPlayer("Sciences", "S", 100000);
+    Player* eng = game.addPlayer("Engineering", "E", 100000);
+    Player* health = game.addPlayer("Health", "H", 100000);
+    give(controller, mover, {"AL", "ML", "MKV", "ECH", "PAS", "HH", "EIT", "ESC", "C2", "MC", "DC"});
+    give(controller, sci, {"PHYS", "B1", "B2", "EV1", "EV2", "EV3"});
+    give(controller, eng, {"RCH", "DWE", "CPH", "UWP", "V1", "REV", "PAC", "CIF"});
+    give(controller, health, {"LHI", "BMH", "OPT"});
+    controller.recalculateAssets();
+    std::cout.setstate(std::ios::failbit);
+    for (const char* name : {"MC", "DC", "MC"}) {
+        controller.improveBuilding(mover, dynamic_cast<AcademicBuilding*>(controller.getBuilding(name)));
+    }
+    controller.improveBuilding(sci, dynamic_cast<AcademicBuilding*>(controller.getBuilding("EV3")));
+    controller.mortgageBuilding(eng, controller.getBuilding("RCH"));
+    mover->moveTo(16);
+    std::cout.clear();
+    health->setInTims(true);
+    controller.setStrategy(mover, findStrategy("always-buy"));
+    mover->setMoney(150);
+
+    const std::uint64_t before = controller.stateHash();
+    RiskReport report = assessTurn(controller, game.getBoard(), mover);
+    printRiskMap(std::cout, report, game.getBoard().getDefinition());
+    check("Assessing a turn changes nothing", controller.stateHash() == before);
+    check("The position cannot go bankrupt", report.bankruptcyProbability == 0);
+
+    // === Against played turns ===
+    const int Trials = 20000;
+    const int reserveBefore = liquidationValue(mover, game.getBoard());
+    std::mt19937 seeds{2024};
+    AnalyticsBlock landings;
+    double sum = 0, sumSquares = 0;
+    int shortfalls = 0;
+    std::cout.setstate(std::ios::failbit);
+    for (int t = 0; t < Trials; ++t) {
+        std::unique_ptr<Game> copy = game.fork();
+        copy->getController().seed(seeds());
+        copy->getController().setAnalytics(&landings);
+        Player* p = copy->getPlayer(0);
+        copy->getController().playTurn(p);
+        // Received minus paid: what liquidation raised does not count.
+        const int raised = reserveBefore - liquidationValue(p, copy->getBoard());
+        const double delta = p->getMoney() - 150 - raised;
+        sum += delta;
+        sumSquares += delta * delta;
+        shortfalls += raised > 0;
+    }
+    std::cout.clear();
+    std::cout.width(0);
+
+    const double mean = sum / Trials;
+    const double error = std::sqrt((sumSquares / Trials - mean * mean) / Trials);
+    const double shortfallRate = static_cast<double>(shortfalls) / Trials;
+    std::cout << "  exact " << report.expectedCashChange << " played " << mean << " +- " << error << "\n";
+    std::cout << "  shortfall exact " << report.shortfallProbability << " played " << shortfallRate << "\n";
+    check("Expected cash change matches played turns",
+          std::abs(mean - report.expectedCashChange) < 4 * error);
+    const double p = report.shortfallProbability;
+    check("Shortfall chance matches played turns",
+          std::abs(shortfallRate - p) < 4 * std::sqrt(p * (1 - p) / Trials) + 1e-9);
+    bool landingsMatch = true;
+    for (int pos = 0; pos < BoardDefinition::Squares; ++pos) {
+        const double q = report.squares[pos].landing;
+        const double played = static_cast<double>(landings.squares[pos].landings) / Trials;
+        landingsMatch = landingsMatch && std::abs(played - q) < 4.5 * std::sqrt(q * (1 - q) / Trials) + 1e-9;
+    }
+    check("Every square's landing chance matches played turns", landingsMatch);
+
+    // === Exact cases ===
+    Game small;
+    Player* broke = small.addPlayer("Broke", "B", 10);
+    small.addPlayer("Other", "O");
+    std::cout.setstate(std::ios::failbit);
+    broke->moveTo(10);
+    std::cout.clear();
+    broke->setInTims(true);
+    for (int i = 0; i < 2; ++i) broke->incrementTimsTurn();
+    RiskReport jail = assessTurn(small.getController(), small.getBoard(), broke);
+    // Doubles leave with $10, which Needles Hall can still take.
+    check("A third miss with $10 and nothing to sell is bankruptcy 5/6 of the time",
+          std::abs(jail.squares[10].bankruptcy - 5.0 / 6) < 1e-12 &&
+          jail.bankruptcyProbability > 5.0 / 6 && jail.timsOption == TimsOption::Roll);
+
+    Player* walker = small.getPlayer(1);
+    RiskReport free = assessTurn(small.getController(), small.getBoard(), walker);
+    double firstRoll = 0;
+    for (int pos = 2; pos <= 12; ++pos) firstRoll += free.squares[pos].landing;
+    // From OSAP the first roll lands on 2..12 (re-rolls add to that).
+    check("Out of the Tims line no option is reported", free.timsOption == TimsOption::NotInLine);
+    check("The first roll always lands", firstRoll >= 1 - 1e-12 && free.shortfallProbability == 0);
+
+    std::cin.rdbuf(savedCin);
+    std::cout << "\n=== END OF TEST ===\n";
+    return 0;
+}
@@ -0,0 +1,103 @@
+// test-save.cc
+// Purpose:
+//   Verifies that a game written with writeSaveFile() reads back with
+//   readSaveFile() to the same players (money, position, cups, Tims state),
+//   owners, improvements, mortgages and computer strategies, and that a bad
+//   player count, a malformed player line, an improvement count outside
+//   0-5 or an unknown strategy is rejected.
+import <iostream>;
+import <sstream>;
+import <stdexcept>;
+import <string>;
+import <vector>;
+import SaveFile;
+import Game;
+import GameController;
+import Player;
+import Building;
+import AcademicBuilding;
+import Strategy;
+import TestCheck;
+
+int main() {
+    std::cout << "=== SAVE FILE TEST ===\n\n";
+
+    Game game;
+    Player* vyomm = game.addPlayer("Vyomm", "V");
+    Player* bhavish = game.addPlayer("Bhavish", "B");
+    GameController& controller = game.getController();
+    controller.getBuilding("AL")->setOwner(vyomm);
+    controller.getBuilding("ML")->setOwner(vyomm);
+    dynamic_cast<AcademicBuilding*>(controller.getBuilding("ML"))->forceSetImprovements(2);
+    controller.getBuilding("PAC")->setOwner(bhavish);
+    controller.mortgageBuilding(bhavish, controller.getBuilding("PAC"));
+    vyomm->setRollUpCups(1);
+    vyomm->moveTo(10);
+    vyomm->setInTims(true);
+    vyomm->incrementTimsTurn();
+    bhavish->moveTo(27);
+    controller.setStrategy(bhavish, findStrategy("roi-threshold"));
+
+    std::stringstream file;
+    writeSaveFile(file, game.getPlayers(), game.getBoard(), controller);
+    std::cout << file.str() << "\n";
+
+    Game loaded;
+    std::vector<Player*> players = readSaveFile(file, loaded);
+    GameController& loadedController = loaded.getController();
+    check("Players restored in turn order",
+          players.size() == 2 && players[0]->getName() == "Vyomm" && players[1]->getToken() == "B");
+    check("Position, cups and Tims state restored",
+          players[0]->getPosition() == 10 && players[0]->getRollUpCups() == 1 &&
+          players[0]->isInTims() && players[0]->getTimsTurns() == 1 && players[1]->getPosition() == 27);
+    check("Owners restored", loadedController.getBuilding("AL")->getOwner() == players[0] &&
+                             loadedController.getBuilding("PAC")->getOwner() == players[1] &&
+                             !loadedController.getBuilding("EV1")->getOwner());
+    check("Improvements restored",
+          dynamic_cast<AcademicBuilding*>(loadedController.getBuilding("ML"))->getImprovementCount() == 2);
+    check("Mortgages restored", loadedController.getBuilding("PAC")->isMortgaged());
+    check("Money restored", players[0]->getMoney() == vyomm->getMoney() &&
+                            players[1]->getMoney() == bhavish->getMoney());
+    check("Strategies restored", !loadedController.getStrategy(players[0]) &&
+                                 loadedController.getStrategy(players[1]) == findStrategy("roi-threshold"));
+
+    std::istringstream onePlayer{"1\nSolo S 0 1500 0\n"};
+    Game rejected;
+    bool threw = false;
+    try {
+        readSaveFile(onePlayer, rejected);
+    } catch (const std::runtime_error&) {
+        threw = true;
+    }
+    check("A save file with one player is rejected", threw && rejected.playerCount() == 0);
+
+    // Not in the Tims line at position 10 ("0"), then a strategy nobody knows.
+    std::istringstream unknown{"2\nAlice A 0 1500 10 0 always-buy\nBob B 0 1500 0 mystery\n"};
+    Game unknownGame;
+    std::string error;
+    try {
+        readSaveFile(unknown, unknownGame);
+    } catch (const std::runtime_error& e) {
+        error = e.what();
+    }
+    check("An unknown strategy is rejected", error == "unknown strategy mystery for Bob" &&
+          unknownGame.getController().getStrategy(unknownGame.getPlayer(0)) == findStrategy("always-buy"));
+
+    // A missing field, a square off the board, then six improvements.
+    auto rejects = [](const std::string& text) {
+        std::istringstream in{text};
+        Game bad;
+        try {
+            readSaveFile(in, bad);
+        } catch (const std::runtime_error&) {
+            return true;
+        }
+        return false;
+    };
+    check("A malformed player line is rejected", rejects("2\nAlice A 0 1500\nBob B 0 1500 0\n") &&
+                                                 rejects("2\nAlice A 0 1500 40\nBob B 0 1500 0\n"));
+    check("Six improvements are rejected", rejects("2\nAlice A 0 1500 0\nBob B 0 1500 0\nAL Alice 6\n"));
+
+    std::cout << "\n=== END OF TEST ===\n";
+    return 0;
+}
@@ -0,0 +1,100 @@
+// test-spectator.cc
+// Purpose:
+//   Checks the spectator feed end to end:
+//     1. A viewer connected to the Unix socket receives the published events
+//        in order, with sequence numbers.
+//     2. Publishing never blocks: a burst far larger than the ring while the
+//        viewer is not reading is either queued or counted as dropped, and
+//        the game side returns immediately.
+//     3. An existing regular file at the feed's path is neither deleted nor
+//        replaced; the channel just stays closed.
+#include <sys/socket.h>
+#include <sys/stat.h>
+#include <sys/un.h>
+#include <unistd.h>
+#include <cstring>
+
+import <fstream>;
+import <iostream>;
+import <string>;
+import <chrono>;
+import <thread>;
+import Spectator;
+import TestCheck;
+
+static int connectViewer(const std::string& path) {
+    int fd = ::socket(AF_UNIX, SOCK_STREAM, 0);
+    sockaddr_un addr{};
+    addr.sun_family = AF_UNIX;
+    std::strncpy(addr.sun_path, path.c_str(), sizeof(addr.sun_path) - 1);
+    if (::connect(fd, reinterpret_cast<sockaddr*>(&addr), sizeof(addr)) != 0) {
+        ::close(fd);
+        return -1;
+    }
+    return fd;
+}
+
+int main() {
+    std::cout << "=== SPECTATOR FEED TEST ===\n";
+    const std::string path = "/tmp/watopoly-spectator-test.sock";
+
+    SpectatorChannel channel(path);
+    check("Channel open", channel.isOpen());
+
+    int viewer = connectViewer(path);
+    check("Viewer connected", viewer >= 0);
+    std::this_thread::sleep_for(std::chrono::milliseconds(50));  // let the writer accept
+
+    // --- 1. Ordered delivery ---
+    SpectatorEvent dice;
+    dice.type = SpectatorEventType::Dice;
+    setEventToken(dice.actor, "V");
+    dice.square = 5;
+    dice.a = 3;
+    dice.b = 4;
+    channel.publish(dice);
+
+    SpectatorEvent buy;
+    buy.type = SpectatorEventType::Ownership;
+    setEventToken(buy.actor, "V");
+    buy.square = 5;
+    channel.publish(buy);
+
+    std::this_thread::sleep_for(std::chrono::milliseconds(50));
+    char buf[256] = {};
+    ssize_t n = ::recv(viewer, buf, sizeof(buf) - 1, 0);
+    std::string got = n > 0 ? std::string(buf, n) : "";
+    std::cout << "[Viewer] " << got;
+    bool ordered = got == "1 DICE 5 V BANK 3 4\n2 OWN 5 V BANK 0 0\n";
+    check("Events delivered in order", ordered);
+
+    // --- 2. Burst while the viewer is not reading ---
+    auto start = std::chrono::steady_clock::now();
+    int accepted = 0;
+    for (int i = 0; i < 200000; ++i) {
+        dice.a = i % 6 + 1;
+        if (channel.publish(dice)) ++accepted;
+    }
+    auto elapsed = std::chrono::duration_cast<std::chrono::milliseconds>(
+        std::chrono::steady_clock::now() - start).count();
+
+    std::cout << "[Burst] accepted " << accepted << " / 200000 in " << elapsed << " ms\n";
+    std::this_thread::sleep_for(std::chrono::milliseconds(100));
+    std::cout << "[Burst] dropped so far: " << channel.droppedCount() << "\n";
+    check("Slow viewer caused drops, not blocking", channel.droppedCount() > 0 && elapsed < 1000);
+
+    ::close(viewer);
+
+    // --- 3. Not a socket or FIFO ---
+    const std::string notes = "/tmp/watopoly-spectator-test.txt";
+    std::ofstream{notes} << "keep me\n";
+    bool kept;
+    {
+        SpectatorChannel onFile(notes);
+        struct stat st;
+        kept = !onFile.isOpen() && ::stat(notes.c_str(), &st) == 0 && S_ISREG(st.st_mode);
+    }
+    check("A regular file is left alone", kept);
+    ::unlink(notes.c_str());
+    return 0;
+}
@@ -0,0 +1,149 @@
+// test-strategy.cc
+// Purpose:
+//   Verifies computer players: the built-in strategies' rules on fixed
+//   positions, and that GameController takes every decision of a seat with
+//   a strategy from it (purchase, auction, Tims line, raising funds, trade
+//   offers) without reading std::cin, while human seats still read it. A
+//   pure bot table plays on without input, and forks keep their bots.
+import <iostream>;
+import <memory>;
+import <sstream>;
+import <string>;
+import <vector>;
+import Strategy;
+import Game;
+import GameController;
+import Player;
+import Building;
+import TestCheck;
+
+int main() {
+    std::cout << "=== STRATEGY TEST ===\n\n";
+
+    // === Registry ===
+    std::vector<std::string> names;
+    for (const Strategy* s : builtinStrategies()) names.emplace_back(s->name());
+    check("Built-in strategies by name",
+          names == std::vector<std::string>{"always-buy", "block-focused", "cash-conservative", "roi-threshold"} &&
+          findStrategy("roi-threshold") == builtinStrategies()[3] && !findStrategy("human"));
+
+    // === Rules ===
+    Game rules;
+    Player* ann = rules.addPlayer("Ann", "A");
+    Player* bob = rules.addPlayer("Bob", "B");
+    GameController& rc = rules.getController();
+    const Board& board = rules.getBoard();
+    Building* al = rc.getBuilding("AL");
+    Building* ml = rc.getBuilding("ML");
+    Building* dc = rc.getBuilding("DC");
+    Building* ev1 = rc.getBuilding("EV1");
+
+    AlwaysBuyStrategy alwaysBuy;
+    check("always-buy buys what it can afford, bids the price",
+          alwaysBuy.buy(*ann, *dc, board) && alwaysBuy.maxBid(*ann, *dc, board) == 400);
+
+    CashConservativeStrategy conservative{500};
+    ann->setMoney(540);
+    check("cash-conservative keeps its reserve",
+          conservative.buy(*ann, *al, board) && !conservative.buy(*ann, *ml, board) &&
+          conservative.maxBid(*ann, *dc, board) == 40 && !conservative.payTimsFine(*ann, board));
+    ann->setMoney(1500);
+
+    BlockFocusedStrategy blockFocused;
+    al->setOwner(ann);
+    rc.getBuilding("MC")->setOwner(bob);
+    rc.getBuilding("EV2")->setOwner(bob);
+    check("block-focused pays a premium to complete a block", blockFocused.maxBid(*ann, *ml, board) == 90);
+    check("block-focused denies a rival's block", blockFocused.buy(*ann, *dc, board));
+    check("block-focused passes on a split block",
+          !blockFocused.buy(*ann, *ev1, board) && blockFocused.maxBid(*ann, *ev1, board) == 110);
+
+    RoiThresholdStrategy roi{0.1};
+    al->setOwner(nullptr);
+    bool before = !roi.buy(*ann, *al, board) && roi.maxBid(*ann, *al, board) == 20;
+    ml->setOwner(ann);
+    check("roi-threshold buys at 10% rent per dollar",
+          roi.buy(*ann, *dc, board) && before && roi.buy(*ann, *al, board));
+    check("Tuition: the cheaper payment by default", roi.payTuitionPercent(*ann));
+
+    // === Decisions through the controller (std::cin must stay untouched) ===
+    std::istringstream input{"y\nSENTINEL\n"};
+    auto* savedCin = std::cin.rdbuf(input.rdbuf());
+    std::cout.setstate(std::ios::failbit);
+
+    // A bot declines; the bots' auction ends at $50 (Cal stops at its $40).
+    Game table;
+    Player* buyer = table.addPlayer("Ann", "A");
+    Player* saver = table.addPlayer("Cal", "C");
+    Player* human = table.addPlayer("Hana", "H");
+    GameController& controller = table.getController();
+    controller.setStrategy(buyer, findStrategy("always-buy"));
+    controller.setStrategy(saver, findStrategy("cash-conservative"));
+    human->setBankrupt(true);  // out of the auction for now
+    saver->setMoney(540);
+    controller.simulateTurn(saver, 1, 2);  // ML, $60
+    bool auctioned = controller.getBuilding("ML")->getOwner() == buyer && buyer->getMoney() == 1450;
+
+    // Tims line: always-buy pays $50, cash-conservative rolls (and stays).
+    buyer->moveTo(10);
+    buyer->setInTims(true);
+    saver->moveTo(10);
+    saver->setInTims(true);
+    controller.simulateTurn(buyer, 4, 6);  // Goose Nesting
+    controller.simulateTurn(saver, 4, 6);
+    bool tims = !buyer->isInTims() && buyer->getMoney() == 1400 && saver->isInTims();
+
+    // Short of cash: the bot liquidates on its own.
+    controller.getBuilding("DC")->setOwner(saver);
+    controller.recalculateAssets();
+    saver->setMoney(10);
+    bool paid = controller.enforcePayment(saver, 100) && controller.getBuilding("DC")->isMortgaged() &&
+                saver->getMoney() == 110;
+
+    // Trade offers to a bot: AL ($40) for $100 is refused, for $20 accepted.
+    human->setBankrupt(false);
+    controller.getBuilding("AL")->setOwner(human);
+    controller.trade("H", "AL", "A", "100");
+    bool refused = controller.getBuilding("AL")->getOwner() == human;
+    controller.trade("H", "AL", "A", "20");
+    bool accepted = controller.getBuilding("AL")->getOwner() == buyer;
+
+    // Mixed table: the human answers "y" from std::cin.
+    controller.simulateTurn(human, 2, 3);  // MKV
+    bool humanBought = controller.getBuilding("MKV")->getOwner() == human;
+
+    // Pure bot table: one seat per built-in strategy, no input at all.
+    Game bots;
+    for (int i = 0; i < 4; ++i) {
+        Player* p = bots.addPlayer("Bot" + std::to_string(i), std::string(1, "GBDP"[i]));
+        bots.getController().setStrategy(p, builtinStrategies()[i]);
+    }
+    bots.getController().seed(7);
+    int turns = 0;
+    for (; turns < 400; ++turns) {
+        int active = 0;
+        for (int i = 0; i < 4; ++i) active += !bots.getPlayer(i)->isBankrupt();
+        if (active < 2) break;  // game over
+        Player* p = bots.getPlayer(turns % 4);
+        if (!p->isBankrupt()) bots.getController().playBotTurn(p);
+    }
+    std::unique_ptr<Game> fork = bots.fork();
+
+    std::string left;
+    std::cin >> left;
+    std::cout.clear();
+    std::cin.rdbuf(savedCin);
+
+    check("A declined purchase is auctioned between bots", auctioned);
+    check("Tims line decisions", tims);
+    check("Bots raise funds automatically", paid);
+    check("Bots judge trade offers", refused && accepted);
+    check("Human seats still read std::cin", humanBought);
+    check("A pure bot table plays without input", turns > 100 && left == "SENTINEL");
+    check("Forks keep their bots",
+          fork->getController().getStrategy(fork->getPlayer(2)) == findStrategy("cash-conservative") &&
+          !controller.getStrategy(human));
+
+    std::cout << "\n=== END OF TEST ===\n";
+    return 0;
+}
@@ -0,0 +1,124 @@
+// test-trace.cc
+// Purpose:
+//   Verifies the trace-event export: nothing is recorded before
+//   Tracer::start(); a game on the main thread produces turn, phase,
+//   purchase/auction and render spans; games on worker threads land in
+//   their own thread buffers, tagged with their own game IDs; and the
+//   written file has one well-formed event per line.
+import <cstdio>;
+import <fstream>;
+import <iostream>;
+import <map>;
+import <set>;
+import <sstream>;
+import <string>;
+import <thread>;
+import <vector>;
+import Trace;
+import Game;
+import GameController;
+import Player;
+import Building;
+import new_Display;
+import TestCheck;
+
+// Value of a numeric field ("tid", "game") in one event line.
+static long field(const std::string& line, const std::string& key) {
+    std::size_t at = line.find("\"" + key + "\":");
+    return at == std::string::npos ? -1 : std::stol(line.substr(at + key.size() + 3));
+}
+
+static void useProxyBots(GameController& controller) {
+    controller.setAuctionMode(AuctionMode::ProxyEnglish);
+    controller.setProxyBidSource([](const Player*, const Building* b) { return b->getPrice(); });
+}
+
+int main() {
+    std::cout << "=== TRACE TEST ===\n\n";
+    const std::string path = "test-trace.json";
+
+    std::istringstream noInput;
+    auto* savedCin = std::cin.rdbuf(noInput.rdbuf());
+    std::cout.setstate(std::ios::failbit);
+
+    // Before start(): not recorded.
+    Game game;
+    Player* vyomm = game.addPlayer("Vyomm", "V");
+    game.addPlayer("Bhavish", "B");
+    GameController& controller = game.getController();
+    useProxyBots(controller);
+    bool offBeforeStart = !Tracer::enabled();
+    controller.simulateTurn(vyomm, 1, 2);
+
+    Tracer::start(path);
+
+    // Main thread: turns with declined purchases going to auction, and a render.
+    controller.simulateTurn(vyomm, 2, 4);   // 9: HH, declined, auctioned
+    controller.simulateTurn(vyomm, 1, 2);   // 12: PAC, declined, auctioned
+    {
+        TraceGameScope scope{controller.getTraceGameId()};
+        new_Display{}.printGameBoard(game.getBoard(), game.getPlayers());
+    }
+
+    // Two workers, each with its own game: auctions and automatic liquidation.
+    std::vector<std::thread> workers;
+    std::uint32_t workerGames[2] = {};
+    for (int t = 0; t < 2; ++t) {
+        workers.emplace_back([t, &workerGames] {
+            Game own;
+            Player* a = own.addPlayer("A", "A");
+            own.addPlayer("B", "B");
+            GameController& c = own.getController();
+            useProxyBots(c);
+            workerGames[t] = c.getTraceGameId();
+            c.handleAuction(c.getBuilding("AL"));
+            c.handleAuction(c.getBuilding("ML"));
+            a->setMoney(10);
+            c.raiseFundsAutomatically(a, 30);
+        });
+    }
+    for (auto& w : workers) w.join();
+
+    std::cout.clear();
+    std::cout.width(0);  // left over from the muted board
+    std::cin.rdbuf(savedCin);
+    Tracer::stop();
+
+    std::ifstream in(path);
+    std::string header, line;
+    std::getline(in, header);
+    std::map<std::string, int> spans;        // name -> count
+    std::set<long> tids;
+    std::map<long, std::set<long>> gamesByTid;
+    bool wellFormed = header == "{\"displayTimeUnit\":\"ns\",\"traceEvents\":[";
+    std::string last;
+    while (std::getline(in, line)) {
+        last = line;
+        if (line.find("\"ph\":\"X\"") == std::string::npos) continue;
+        wellFormed = wellFormed && line.rfind("{\"name\":\"", 0) == 0 && field(line, "dur") >= 0;
+        std::string name = line.substr(9, line.find('"', 9) - 9);
+        ++spans[name];
+        tids.insert(field(line, "tid"));
+        gamesByTid[field(line, "tid")].insert(field(line, "game"));
+    }
+    wellFormed = wellFormed && last == "]}";
+
+    for (const auto& [name, count] : spans) std::cout << "  " << name << ": " << count << "\n";
+    check("Tracing is on between start and stop", offBeforeStart && !Tracer::enabled());
+    check("File is one trace-event array", wellFormed);
+    check("Turns after start only", spans["turn"] == 2);
+    check("Phase spans per turn", spans["roll"] == 2 && spans["move"] == 2 && spans["resolve"] == 2);
+    check("Decision spans", spans["purchase"] == 2 && spans["auction"] == 6 && spans["raise funds (auto)"] == 2);
+    check("Render span", spans["render"] == 1);
+    check("One buffer per thread", tids.size() == 3);
+    bool ownGames = true;
+    for (const auto& [tid, games] : gamesByTid) {
+        ownGames = ownGames && games.size() == 1;
+        if (tid == 1) ownGames = ownGames && *games.begin() == controller.getTraceGameId();
+    }
+    check("Each thread's spans carry its game ID", ownGames && workerGames[0] != workerGames[1]);
+
+    std::remove(path.c_str());
+    std::cout << "\n=== END OF TEST ===\n";
+    return 0;
+}
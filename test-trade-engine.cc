@@ -0,0 +1,97 @@
+// test-trade-engine.cc
+// Purpose:
+//   Verifies the batch trade evaluator: it finds the swap that completes a
+//   monopoly for both sides, only returns trades neither side loses on,
+//   skips blocks with improvements, gives the same answer for any thread
+//   count, and its top pick executes through GameController::trade.
+import <iostream>;
+import <sstream>;
+import <string>;
+import <vector>;
+import GameController;
+import Board;
+import Player;
+import Building;
+import AcademicBuilding;
+import TradeEngine;
+import TestCheck;
+
+int main() {
+    std::cout << "=== TRADE ENGINE TEST ===\n\n";
+
+    GameController controller;
+    Board board;
+    controller.setBoard(&board);
+
+    Player* vyomm = new Player("Vyomm", "V");
+    Player* bhavish = new Player("Bhavish", "B");
+    Player* third = new Player("Third", "T");
+    controller.addPlayer(vyomm);
+    controller.addPlayer(bhavish);
+    controller.addPlayer(third);
+
+    auto own = [&](const std::string& name, Player* p) {
+        dynamic_cast<Building*>(board.getSquareByName(name))->setOwner(p);
+    };
+
+    // Vyomm: AL (Arts1), EV2 + EV3 (Env), and all of Eng with an improvement.
+    // Bhavish: ML (Arts1), EV1 (Env). Third: MKV.
+    for (auto name : {"AL", "EV2", "EV3", "RCH", "DWE", "CPH"}) own(name, vyomm);
+    for (auto name : {"ML", "EV1"}) own(name, bhavish);
+    own("MKV", third);
+    controller.improveBuilding(vyomm, dynamic_cast<AcademicBuilding*>(board.getSquareByName("RCH")));
+
+    std::vector<TradeCandidate> trades = controller.evaluateTrades();
+    check("Found candidates", !trades.empty());
+
+    bool allAcceptable = true, improvedBlockOffered = false;
+    for (const auto& t : trades) {
+        allAcceptable = allAcceptable && t.fromGain >= 0 && t.toGain >= 0;
+        for (int pos : {t.give, t.receive}) {
+            if (pos < 0) continue;
+            auto* ab = dynamic_cast<AcademicBuilding*>(board.getSquare(pos));
+            if (ab && ab->getMonopolyBlock() == "Eng") improvedBlockOffered = true;
+        }
+    }
+    check("Every trade leaves both sides no worse off", allAcceptable);
+    check("Improved block never offered", !improvedBlockOffered);
+
+    const TradeCandidate& best = trades.front();
+    std::string give = tradeGiveString(board, best);
+    std::string receive = tradeReceiveString(board, best);
+    std::cout << "Best: " << best.from->getToken() << " gives " << give
+              << " to " << best.to->getToken() << " for " << receive
+              << " (score " << best.score() << ")\n";
+    // Swaps are listed once per pair (from = earlier player in token order).
+    check("Best trade swaps AL and EV1 between V and B",
+          (best.from == vyomm && give == "AL" && receive == "EV1") ||
+          (best.from == bhavish && give == "EV1" && receive == "AL"));
+
+    // Same answer regardless of parallelism.
+    TradeWeights serial;
+    serial.threads = 1;
+    TradeWeights parallel;
+    parallel.threads = 4;
+    auto a = controller.evaluateTrades(serial);
+    auto b = controller.evaluateTrades(parallel);
+    bool same = a.size() == b.size();
+    for (std::size_t i = 0; same && i < a.size(); ++i) {
+        same = a[i].from == b[i].from && a[i].to == b[i].to && a[i].give == b[i].give &&
+               a[i].receive == b[i].receive && a[i].cash == b[i].cash;
+    }
+    check("1 and 4 threads agree", same);
+
+    // Execute the top pick through the normal trade path (Bhavish accepts).
+    std::istringstream accept("y\n");
+    std::streambuf* oldIn = std::cin.rdbuf(accept.rdbuf());
+    controller.trade(best.from->getToken(), give, best.to->getToken(), receive);
+    std::cin.rdbuf(oldIn);
+
+    check("Vyomm now has the Env monopoly", controller.hasMonopoly("V", "Env"));
+    check("Bhavish now has the Arts1 monopoly", controller.hasMonopoly("B", "Arts1"));
+
+    delete vyomm;
+    delete bhavish;
+    delete third;
+    return 0;
+}
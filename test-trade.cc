@@ -43,9 +43,7 @@ int main() {
     // === TEST 1: Valid Property-for-Property ===
     resetBoardState(controller, vyomm, bhavish);
     controller.getBuilding("AL")->setOwnerToken("V");
-    vyomm->addProperty("AL");
     controller.getBuilding("DC")->setOwnerToken("B");
-    bhavish->addProperty("DC");
 
     std::cout << "=== TEST 1: Valid Property-for-Property ===\n";
     controller.trade("V", "AL", "B", "DC");
@@ -63,21 +61,18 @@ int main() {
     // === TEST 4: Ownership Mismatch ===
     resetBoardState(controller, vyomm, bhavish);
     controller.getBuilding("DC")->setOwnerToken("V");
-    vyomm->addProperty("DC");
     std::cout << "\n=== TEST 4: Ownership Mismatch ===\n";
     controller.trade("V", "ECH", "B", "DC");
 
     // === TEST 5: Money for Property ===
     resetBoardState(controller, vyomm, bhavish);
     controller.getBuilding("DC")->setOwnerToken("B");
-    bhavish->addProperty("DC");
     std::cout << "\n=== TEST 5: Money for Property ===\n";
     controller.trade("V", "500", "B", "DC");
 
     // === TEST 6: Property for Money ===
     resetBoardState(controller, vyomm, bhavish);
     controller.getBuilding("AL")->setOwnerToken("V");
-    vyomm->addProperty("AL");
     std::cout << "\n=== TEST 6: Property for Money ===\n";
     controller.trade("V", "AL", "B", "300");
 
@@ -90,10 +85,8 @@ int main() {
     resetBoardState(controller, vyomm, bhavish);
     auto* cph = dynamic_cast<AcademicBuilding*>(controller.getBuilding("CPH"));
     cph->setOwnerToken("V");
-    vyomm->addProperty("CPH");
     cph->addImprovement();
     controller.getBuilding("DC")->setOwnerToken("B");
-    bhavish->addProperty("DC");
     std::cout << "\n=== TEST 8: Trade with Improvements (Should Fail) ===\n";
     controller.trade("V", "CPH", "B", "DC");
 
@@ -102,11 +95,8 @@ int main() {
     auto* dwe = dynamic_cast<AcademicBuilding*>(controller.getBuilding("DWE"));
     cph->setOwnerToken("V");
     dwe->setOwnerToken("V");
-    vyomm->addProperty("CPH");
-    vyomm->addProperty("DWE");
     dwe->addImprovement();
     controller.getBuilding("DC")->setOwnerToken("B");
-    bhavish->addProperty("DC");
     std::cout << "\n=== TEST 9: Trade within Improved Monopoly (Should Fail) ===\n";
     controller.trade("V", "CPH", "B", "DC");
 
@@ -115,8 +105,6 @@ int main() {
     bhavish->setInTims(true);
     controller.getBuilding("ML")->setOwnerToken("V");
     controller.getBuilding("DC")->setOwnerToken("B");
-    vyomm->addProperty("ML");
-    bhavish->addProperty("DC");
     std::cout << "\n=== TEST 10: Accepting Trade While in Jail ===\n";
     controller.trade("V", "ML", "B", "DC");
 
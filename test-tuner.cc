@@ -0,0 +1,67 @@
+// test-tuner.cc
+// Purpose:
+//   Verifies the strategy tuner: "tuned:..." names parse into shared
+//   ParametricStrategy instances; identical candidates score identically
+//   (common random numbers); fitness does not depend on the thread count;
+//   and a short GA run reports every generation and returns parameters in
+//   range whose name reads back exactly.
+import <iostream>;
+import <string>;
+import <vector>;
+import Strategy;
+import Tuner;
+import TestCheck;
+
+int main() {
+    std::cout << "=== TUNER TEST ===\n\n";
+
+    // === Names ===
+    const Strategy* tuned = findStrategy("tuned:0.05,0.1,250,0.9");
+    auto* parametric = dynamic_cast<const ParametricStrategy*>(tuned);
+    check("A tuned name parses",
+          parametric && parametric->params() == StrategyParams{0.05, 0.1, 250, 0.9} &&
+          tuned->name() == "tuned:0.05,0.1,250,0.9");
+    check("One instance per parameter set", findStrategy("tuned:0.050,0.10,250,0.90") == tuned);
+    check("Malformed names are rejected",
+          !findStrategy("tuned:0.1,x") && !findStrategy("tuned:0.1,0.1,250,1,7") && !findStrategy("tuned"));
+
+    // === Evaluation ===
+    TunerConfig config;
+    config.games = 8;
+    config.maxRounds = 40;
+    config.threads = 4;
+    StrategyParams cautious{0.12, 0.3, 600, 0.5};
+    std::vector<StrategyParams> population{StrategyParams{}, cautious, StrategyParams{}};
+    std::vector<double> parallel = evaluatePopulation(population, config, 11);
+    config.threads = 1;
+    std::vector<double> serial = evaluatePopulation(population, config, 11);
+
+    for (double f : parallel) std::cout << "  fitness " << f << "\n";
+    bool inRange = true;
+    for (double f : parallel) inRange = inRange && f >= 0.0 && f <= 1.0;
+    check("Fitness is a mean score in [0, 1]", inRange);
+    check("Identical candidates score identically", parallel[0] == parallel[2]);
+    check("Fitness does not depend on the thread count", parallel == serial);
+
+    // === A short run ===
+    config.threads = 0;
+    config.population = 6;
+    config.generations = 3;
+    config.elite = 1;
+    int reports = 0;
+    StrategyParams best = tuneStrategy(config, [&](const GenerationReport& r) {
+        reports += r.generation == reports && r.games == 6 * 8 && r.seconds > 0;
+    });
+    std::string name{ParametricStrategy{best}.name()};
+    std::cout << "  best " << name << "\n";
+    check("Every generation is reported", reports == 3);
+    check("Best parameters are in range",
+          best.buyThreshold >= 0 && best.buyThreshold <= 0.25 && best.improveThreshold >= 0 &&
+          best.improveThreshold <= 0.5 && best.cashReserve >= 0 && best.cashReserve <= 1000 &&
+          best.bidFraction >= 0.2 && best.bidFraction <= 2.0);
+    auto* loaded = dynamic_cast<const ParametricStrategy*>(findStrategy(name));
+    check("The best strategy's name reads back exactly", loaded && loaded->params() == best);
+
+    std::cout << "\n=== END OF TEST ===\n";
+    return 0;
+}
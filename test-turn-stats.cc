@@ -0,0 +1,84 @@
+// test-turn-stats.cc
+// Purpose:
+//   Verifies the turn latency histograms (counts, p50/p99 within a bucket,
+//   max) and that the controller feeds them from playTurn: every phase a
+//   turn passes through is recorded in a TURN_STATS=1 build, and nothing is
+//   recorded (PhaseTimer is an empty no-op) otherwise.
+import <iostream>;
+import <sstream>;
+import <string>;
+import TurnStats;
+import Game;
+import GameController;
+import Player;
+import Building;
+import TestCheck;
+
+// Within one histogram bucket (1/8 of the value) of the expected value.
+static bool near(std::uint64_t value, std::uint64_t expected) {
+    std::uint64_t diff = value > expected ? value - expected : expected - value;
+    return diff * 8 <= expected;
+}
+
+int main() {
+    std::cout << "=== TURN STATS TEST (" << (turnStatsEnabled ? "enabled" : "disabled") << ") ===\n\n";
+
+    // === Histogram ===
+    LatencyHistogram h;
+    for (std::uint64_t ns = 1; ns <= 1000; ++ns) h.record(ns * 100);  // 100 ns .. 100 us
+    check("Histogram counts samples", h.count() == 1000);
+    check("Histogram keeps the max", h.max() == 100000);
+    check("p50 is about 50 us", near(h.percentile(0.5), 50000));
+    check("p99 is about 99 us", near(h.percentile(0.99), 99000));
+    check("p100 is the max", h.percentile(1.0) == 100000);
+
+    LatencyHistogram small;
+    for (int i = 0; i < 10; ++i) small.record(7);
+    check("Small values are exact", small.percentile(0.5) == 7 && small.percentile(0.99) == 7);
+    check("Empty histogram reports 0", LatencyHistogram{}.percentile(0.5) == 0);
+
+    // === Fed from the turn pipeline ===
+    std::istringstream noInput;
+    auto* savedCin = std::cin.rdbuf(noInput.rdbuf());
+    TurnStats stats;
+    Game game;
+    Player* vyomm = game.addPlayer("Vyomm", "V");
+    Player* bhavish = game.addPlayer("Bhavish", "B");
+    GameController& controller = game.getController();
+    controller.setTurnStats(&stats);
+    controller.setAuctionMode(AuctionMode::ProxyEnglish);
+    controller.setProxyBidSource([](const Player*, const Building*) { return 10; });
+    controller.getBuilding("EV1")->setOwner(bhavish);
+
+    std::cout.setstate(std::ios::failbit);
+    vyomm->moveTo(19);
+    controller.simulateTurn(vyomm, 1, 2);   // Needles Hall
+    vyomm->moveTo(18);
+    controller.simulateTurn(vyomm, 1, 2);   // EV1: rent to Bhavish
+    controller.simulateTurn(vyomm, 2, 1);   // EV3: declined, proxy auction
+    std::cout.clear();
+    std::cin.rdbuf(savedCin);
+
+    auto count = [&](StatPhase phase) { return stats.histogram(phase).count(); };
+    if (turnStatsEnabled) {
+        check("Every playTurn is timed", count(StatPhase::Turn) == 3);
+        check("Rolls, moves and landings are timed",
+              count(StatPhase::Roll) == 3 && count(StatPhase::Move) == 3 && count(StatPhase::Land) == 3);
+        check("Rent and payment are timed", count(StatPhase::Rent) == 1 && count(StatPhase::Payment) >= 1);
+        check("Auctions are timed", count(StatPhase::Auction) == 1);
+        check("A turn takes at least as long as its roll",
+              stats.histogram(StatPhase::Turn).max() >= stats.histogram(StatPhase::Roll).max());
+    } else {
+        bool none = true;
+        for (int i = 0; i < static_cast<int>(StatPhase::Count); ++i) {
+            none = none && stats.histogram(static_cast<StatPhase>(i)).count() == 0;
+        }
+        check("Nothing is recorded when compiled out", none);
+        check("PhaseTimer is an empty type when compiled out", sizeof(PhaseTimer) == 1);
+    }
+
+    std::cout << "\n";
+    stats.print(std::cout);
+    std::cout << "\n=== END OF TEST ===\n";
+    return 0;
+}
@@ -8,15 +8,14 @@ import AcademicBuilding;
 import Residence;
 import Gym;
 import Building;
-import <cstdlib>;
 import <ctime>;
 
 int main() {
-    std::srand(std::time(nullptr));
     std::cout << "=== WATOPOLY: Turn Simulation ===\n\n";
 
     // ---------- Game Setup ----------
     GameController controller;
+    controller.seed(std::time(nullptr));
     Board* board = new Board();
     controller.setBoard(board);
 
@@ -32,13 +31,10 @@ auto* mkv = dynamic_cast<Building*>(board->getSquareByName("MKV"));
 auto* pac = dynamic_cast<Building*>(board->getSquareByName("PAC"));
 
     ev1->setOwnerToken(p1->getToken());
-    p1->addProperty(ev1->getName());
 
     mkv->setOwnerToken(p2->getToken());
-    p2->addProperty(mkv->getName());
 
     pac->setOwnerToken(p1->getToken());
-    p1->addProperty(pac->getName());
 
     std::cout << "--- Assigned EV1 and PAC to Vyomm, MKV to Bhavish ---\n\n";
 
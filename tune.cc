@@ -0,0 +1,57 @@
+// tune.cc
+// Purpose:
+//   Command-line front end of the strategy tuner (see Tuner.cc):
+//     ./tune [-population N] [-generations N] [-games N] [-rounds N]
+//            [-elite N] [-mutation X] [-seed N] [-threads N]
+//            [-vs 'strategy;strategy;...']
+//   -vs chooses the opponents by name (built-in or "tuned:..."), separated
+//   by ';' since tuned names contain commas (quote it for the shell); by
+//   default they are the built-in strategies.
+//
+// Output: one line per generation
+//   GEN <generation> best <fitness> mean <fitness> games/s <rate> <strategy>
+// then the winner as a strategy name, usable at setup and in save files:
+//   BEST tuned:<buy>,<improve>,<reserve>,<bid>
+import <iostream>;
+import <sstream>;
+import <string>;
+import Strategy;
+import Tuner;
+
+int main(int argc, char* argv[]) {
+    TunerConfig config;
+    for (int i = 1; i + 1 < argc; i += 2) {
+        std::string option = argv[i];
+        std::istringstream value{argv[i + 1]};
+        if (option == "-population") value >> config.population;
+        else if (option == "-generations") value >> config.generations;
+        else if (option == "-games") value >> config.games;
+        else if (option == "-rounds") value >> config.maxRounds;
+        else if (option == "-elite") value >> config.elite;
+        else if (option == "-mutation") value >> config.mutation;
+        else if (option == "-seed") value >> config.seed;
+        else if (option == "-threads") value >> config.threads;
+        else if (option == "-vs") {
+            std::string name;
+            while (std::getline(value, name, ';')) {
+                const Strategy* s = findStrategy(name);
+                if (!s) {
+                    std::cerr << "Unknown strategy: " << name << "\n";
+                    return 1;
+                }
+                config.opponents.push_back(s);
+            }
+        } else {
+            std::cerr << "Unknown option: " << option << "\n";
+            return 1;
+        }
+    }
+
+    StrategyParams best = tuneStrategy(config, [](const GenerationReport& r) {
+        std::cout << "GEN " << r.generation << " best " << r.bestFitness << " mean " << r.meanFitness
+                  << " games/s " << (r.seconds > 0 ? static_cast<long long>(r.games / r.seconds) : 0) << " "
+                  << ParametricStrategy{r.best}.name() << std::endl;
+    });
+    std::cout << "BEST " << ParametricStrategy{best}.name() << "\n";
+    return 0;
+}